@@ -191,6 +191,18 @@ static const char use_device_mem_message[] =
     "Optional. Switch between host and device memory allocation for input and output buffers.";
 #endif
 
+/// @brief message for open-loop load rate
+static const char qps_message[] =
+    "Optional. Enables the open-loop mode: the requests are sent at the given rate (requests per second) regardless "
+    "of the completion of the previous ones. The time a request waits for an idle infer request is reported as the "
+    "queueing delay separately from the execution time. Several comma-separated rates are run one after another to "
+    "find the saturation point, for example \"-qps 50,100,200\". Requires asynchronous API.";
+
+/// @brief message for open-loop arrival process
+static const char arrival_message[] =
+    "Optional. Arrival process of the requests in the open-loop mode: \"poisson\" (exponentially distributed "
+    "intervals between the requests) or \"constant\" (fixed intervals). Default value is \"poisson\".";
+
 /// @brief message for latency percentile settings
 static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
@@ -355,6 +367,12 @@ DEFINE_bool(use_device_mem, false, use_device_mem_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Define flag for the target rate of the open-loop mode <br>
+DEFINE_string(qps, "", qps_message);
+
+/// @brief Define flag for the arrival process of the open-loop mode <br>
+DEFINE_string(arrival, "poisson", arrival_message);
+
 /// @brief Enables statistics report collecting
 DEFINE_string(report_type, "", report_type_message);
 
@@ -412,6 +430,8 @@ static void show_usage() {
     std::cout << "    -api <sync/async>             " << api_message << std::endl;
     std::cout << "    -nireq  <integer>             " << infer_requests_count_message << std::endl;
     std::cout << "    -nstreams  <integer>          " << infer_num_streams_message << std::endl;
+    std::cout << "    -qps  <rate[,rate...]>        " << qps_message << std::endl;
+    std::cout << "    -arrival  <poisson/constant>  " << arrival_message << std::endl;
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
     std::cout << "    -infer_precision        " << inference_precision_message << std::endl;
     std::cout << std::endl;
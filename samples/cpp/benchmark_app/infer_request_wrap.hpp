@@ -47,6 +47,14 @@ public:
 
     void start_async() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request which arrived earlier and waited for an idle infer request
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.start_async();
     }
 
@@ -56,6 +64,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
         _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
@@ -83,6 +92,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queue_delay_in_milliseconds() const {
+        auto queueDelay = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueDelay.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -96,6 +110,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -137,6 +152,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueDelays.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -155,6 +171,7 @@ public:
             inferenceException = ptr;
         } else {
             _latencies.push_back(latency);
+            _queueDelays.push_back(requests.at(id)->get_queue_delay_in_milliseconds());
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
@@ -192,6 +209,11 @@ public:
         return _latencies;
     }
 
+    // the time every request waited for an idle infer request, in the same order as the latencies
+    std::vector<double> get_queue_delays() {
+        return _queueDelays;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -205,6 +227,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueDelays;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "latency_histogram.hpp"
+// clang-format on
+
+LatencyHistogram::LatencyHistogram()
+    : _counts(sub_bucket_count + (64 - sub_bucket_bits + 1) * sub_bucket_half, 0) {}
+
+size_t LatencyHistogram::bucket_index(uint64_t value) {
+    if (value < sub_bucket_count)
+        return static_cast<size_t>(value);
+    int msb = 63;
+    while (!(value >> msb))
+        --msb;
+    const int shift = msb - sub_bucket_bits + 1;
+    const uint64_t mantissa = value >> shift;
+    return static_cast<size_t>(sub_bucket_count + (shift - 1) * sub_bucket_half + (mantissa - sub_bucket_half));
+}
+
+double LatencyHistogram::bucket_value(size_t index) {
+    if (index < sub_bucket_count)
+        return static_cast<double>(index);
+    const size_t offset = index - sub_bucket_count;
+    const int shift = static_cast<int>(offset / sub_bucket_half) + 1;
+    const double mantissa = static_cast<double>(offset % sub_bucket_half + sub_bucket_half);
+    // the middle of the bucket
+    return std::ldexp(mantissa + 0.5, shift);
+}
+
+void LatencyHistogram::add(double latency_ms) {
+    latency_ms = std::max(latency_ms, 0.0);
+    const double value_us = std::min(latency_ms * 1000.0, static_cast<double>(std::numeric_limits<int64_t>::max()));
+    _counts[bucket_index(static_cast<uint64_t>(value_us))]++;
+
+    min = _count == 0 ? latency_ms : std::min(min, latency_ms);
+    max = _count == 0 ? latency_ms : std::max(max, latency_ms);
+    _count++;
+    avg += (latency_ms - avg) / static_cast<double>(_count);
+}
+
+double LatencyHistogram::percentile(double percent) const {
+    if (_count == 0)
+        return 0;
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * _count)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < _counts.size(); i++) {
+        seen += _counts[i];
+        if (seen >= rank)
+            return std::min(std::max(bucket_value(i) / 1000.0, min), max);
+    }
+    return max;
+}
+
+void LatencyHistogram::write_to_slog(const std::string& name) const {
+    slog::info << name << " (" << _count << " requests):" << slog::endl;
+    slog::info << "   p50:              " << double_to_string(percentile(50)) << " ms" << slog::endl;
+    slog::info << "   p90:              " << double_to_string(percentile(90)) << " ms" << slog::endl;
+    slog::info << "   p99:              " << double_to_string(percentile(99)) << " ms" << slog::endl;
+    slog::info << "   p99.9:            " << double_to_string(percentile(99.9)) << " ms" << slog::endl;
+    slog::info << "   Average:          " << double_to_string(avg) << " ms" << slog::endl;
+    slog::info << "   Min:              " << double_to_string(min) << " ms" << slog::endl;
+    slog::info << "   Max:              " << double_to_string(max) << " ms" << slog::endl;
+}
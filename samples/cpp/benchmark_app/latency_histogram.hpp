@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief HDR-style latency histogram: the buckets are linear inside each power of two, so every recorded value
+/// is kept with less than 1% relative error independently of its magnitude, while the memory is bounded
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    /// @brief Records the latency in milliseconds
+    void add(double latency_ms);
+
+    /// @brief Returns the latency in milliseconds below which the given percent of the recorded values is
+    double percentile(double percent) const;
+
+    void write_to_slog(const std::string& name) const;
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    double avg = 0;
+    double min = 0;
+    double max = 0;
+
+private:
+    // the values are recorded in microseconds, 2^sub_bucket_bits values per power of two
+    static constexpr int sub_bucket_bits = 8;
+    static constexpr uint64_t sub_bucket_count = 1ULL << sub_bucket_bits;
+    static constexpr uint64_t sub_bucket_half = sub_bucket_count / 2;
+
+    static size_t bucket_index(uint64_t value);
+    static double bucket_value(size_t index);
+
+    std::vector<uint64_t> _counts;
+    uint64_t _count = 0;
+};
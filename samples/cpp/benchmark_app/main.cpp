@@ -6,7 +6,9 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -34,6 +36,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "latency_histogram.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -63,6 +66,12 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (!FLAGS_qps.empty() && FLAGS_api != "async") {
+        throw std::logic_error("The open-loop mode (-qps option) requires asynchronous API.");
+    }
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `poisson` or `constant` value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -102,6 +111,39 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     return true;
 }
 
+std::vector<double> parse_rates(const std::string& rates) {
+    std::vector<double> result;
+    if (rates.empty()) {
+        return result;
+    }
+    for (const auto& rate : split(rates, ',')) {
+        double value = 0;
+        try {
+            value = std::stod(rate);
+        } catch (const std::exception&) {
+        }
+        if (!(value > 0)) {
+            throw std::logic_error("Incorrect -qps value: \"" + rate + "\". The rates should be positive numbers.");
+        }
+        result.push_back(value);
+    }
+    return result;
+}
+
+/// @brief Results of the open-loop run at the target rate
+struct OpenLoopResult {
+    double target_rate = 0;
+    double achieved_rate = 0;
+    LatencyHistogram latency;
+    LatencyHistogram queue_delay;
+    LatencyHistogram execution_time;
+
+    // the rate is sustained if the requests are completed as fast as they arrive
+    bool is_sustained() const {
+        return achieved_rate >= 0.95 * target_rate;
+    }
+};
+
 void next_step(const std::string additional_info = "") {
     static size_t step_id = 0;
     static const std::map<size_t, std::string> step_names = {{1, "Parsing and validating input arguments"},
@@ -994,6 +1036,8 @@ int main(int argc, char* argv[]) {
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
         size_t iteration = 0;
+        // the closed-loop mode is used if no rates are set for the open-loop mode
+        const auto target_rates = parse_rates(FLAGS_qps);
 
         std::stringstream ss;
         ss << "Start inference " << FLAGS_api << "hronously";
@@ -1023,6 +1067,9 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (!target_rates.empty()) {
+            ss << ", open-loop " << FLAGS_arrival << " arrivals at " << FLAGS_qps << " QPS";
+        }
 
         next_step(ss.str());
 
@@ -1113,56 +1160,117 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+        auto prepare_request = [&](const InferReqWrap::Ptr& inferRequest) {
+            if (inferenceOnly) {
+                return;
             }
+            auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+            if (FLAGS_pcseq) {
+                inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+            }
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
-                }
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+            }
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                inferRequest->set_tensor(inputName, data);
+            }
+
+            if (useGpuMem) {
+                auto outputTensors =
+                    ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                 }
+            }
+        };
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+        std::vector<OpenLoopResult> openLoopResults;
+        if (target_rates.empty()) {
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
                 }
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+                prepare_request(inferRequest);
+
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    inferRequest->start_async();
                 }
-            }
+                ++iteration;
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                inferRequest->start_async();
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
             }
-            ++iteration;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
-        }
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
+        } else {
+            // The requests arrive by the schedule independently of the completion of the previous ones. If all infer
+            // requests are busy, the arrived request waits for an idle one, and this wait is its queueing delay
+            std::mt19937 generator;
+            for (const auto rate : target_rates) {
+                if (!openLoopResults.empty()) {
+                    inferRequestsQueue.reset_times();
+                    iteration = 0;
+                    processedFramesN = 0;
+                }
+                std::exponential_distribution<double> poisson_interval(rate);
+                const double constant_interval = 1.0 / rate;
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
+                startTime = Time::now();
+                auto arrivalTime = startTime;
+                execTime = 0;
+                while ((niter != 0LL && iteration < niter) ||
+                       (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds)) {
+                    std::this_thread::sleep_until(arrivalTime);
+                    inferRequest = inferRequestsQueue.get_idle_request();
+                    if (!inferRequest) {
+                        OPENVINO_THROW("No idle Infer Requests!");
+                    }
+
+                    prepare_request(inferRequest);
+                    inferRequest->start_async(arrivalTime);
+                    ++iteration;
+                    processedFramesN += batchSize;
+
+                    const double interval =
+                        FLAGS_arrival == "poisson" ? poisson_interval(generator) : constant_interval;
+                    arrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+                    // the duration limits the schedule, so the overloaded device doesn't increase the number of
+                    // sent requests
+                    execTime = std::chrono::duration_cast<ns>(arrivalTime - startTime).count();
+                }
+                inferRequestsQueue.wait_all();
+
+                OpenLoopResult result;
+                result.target_rate = rate;
+                result.achieved_rate = 1000.0 * iteration / inferRequestsQueue.get_duration_in_milliseconds();
+                const auto latencies = inferRequestsQueue.get_latencies();
+                const auto queueDelays = inferRequestsQueue.get_queue_delays();
+                for (size_t i = 0; i < latencies.size(); i++) {
+                    result.latency.add(queueDelays[i] + latencies[i]);
+                    result.queue_delay.add(queueDelays[i]);
+                    result.execution_time.add(latencies[i]);
+                }
+                slog::info << "Target rate " << double_to_string(rate) << " QPS, achieved rate "
+                           << double_to_string(result.achieved_rate) << " QPS, p99 latency "
+                           << double_to_string(result.latency.percentile(99)) << " ms" << slog::endl;
+                openLoopResults.push_back(std::move(result));
+            }
+        }
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
@@ -1214,6 +1322,37 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            for (size_t i = 0; i < openLoopResults.size(); ++i) {
+                const auto& result = openLoopResults[i];
+                // the rates of the sweep are distinguished by the suffix
+                const std::string csv_suffix =
+                    openLoopResults.size() > 1 ? " at " + double_to_string(result.target_rate) + " QPS" : "";
+                const std::string json_suffix = openLoopResults.size() > 1 ? "_" + std::to_string(i) : "";
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("target rate (QPS)" + csv_suffix, "target_qps" + json_suffix, result.target_rate),
+                     StatisticsVariant("achieved rate (QPS)" + csv_suffix,
+                                       "achieved_qps" + json_suffix,
+                                       result.achieved_rate),
+                     StatisticsVariant("p50 latency (ms)" + csv_suffix,
+                                       "latency_p50" + json_suffix,
+                                       result.latency.percentile(50)),
+                     StatisticsVariant("p90 latency (ms)" + csv_suffix,
+                                       "latency_p90" + json_suffix,
+                                       result.latency.percentile(90)),
+                     StatisticsVariant("p99 latency (ms)" + csv_suffix,
+                                       "latency_p99" + json_suffix,
+                                       result.latency.percentile(99)),
+                     StatisticsVariant("p99.9 latency (ms)" + csv_suffix,
+                                       "latency_p99_9" + json_suffix,
+                                       result.latency.percentile(99.9)),
+                     StatisticsVariant("p99 queueing delay (ms)" + csv_suffix,
+                                       "queue_delay_p99" + json_suffix,
+                                       result.queue_delay.percentile(99)),
+                     StatisticsVariant("p99 execution time (ms)" + csv_suffix,
+                                       "execution_time_p99" + json_suffix,
+                                       result.execution_time.percentile(99))});
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -1292,6 +1431,34 @@ int main(int argc, char* argv[]) {
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
+        if (!openLoopResults.empty()) {
+            slog::info << "Open-loop results (" << FLAGS_arrival << " arrivals):" << slog::endl;
+            for (const auto& result : openLoopResults) {
+                slog::info << "Target rate:         " << double_to_string(result.target_rate) << " QPS" << slog::endl;
+                slog::info << "Achieved rate:       " << double_to_string(result.achieved_rate) << " QPS"
+                           << (result.is_sustained() ? "" : " (saturated)") << slog::endl;
+                result.latency.write_to_slog("Latency (queueing delay + execution time)");
+                result.queue_delay.write_to_slog("Queueing delay");
+                result.execution_time.write_to_slog("Execution time");
+            }
+            if (openLoopResults.size() > 1) {
+                // the knee is the highest rate sustained before the first saturated one
+                const OpenLoopResult* knee = nullptr;
+                for (const auto& result : openLoopResults) {
+                    if (!result.is_sustained())
+                        break;
+                    knee = &result;
+                }
+                if (knee) {
+                    slog::info << "Saturation knee:     " << double_to_string(knee->target_rate) << " QPS (p99 latency "
+                               << double_to_string(knee->latency.percentile(99)) << " ms)" << slog::endl;
+                } else {
+                    slog::info << "Saturation knee:     below " << double_to_string(openLoopResults.front().target_rate)
+                               << " QPS" << slog::endl;
+                }
+            }
+        }
+
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -15,6 +15,8 @@ from openvino._pyopenvino.properties import compilation_num_threads
 from openvino._pyopenvino.properties import affinity
 from openvino._pyopenvino.properties import force_tbb_terminate
 from openvino._pyopenvino.properties import enable_mmap
+from openvino._pyopenvino.properties import cache_max_size
+from openvino._pyopenvino.properties import cache_memory_max_size
 from openvino._pyopenvino.properties import supported_properties
 from openvino._pyopenvino.properties import available_devices
 from openvino._pyopenvino.properties import model_name
@@ -23,6 +25,9 @@ from openvino._pyopenvino.properties import range_for_streams
 from openvino._pyopenvino.properties import optimal_batch_size
 from openvino._pyopenvino.properties import max_batch_size
 from openvino._pyopenvino.properties import range_for_async_infer_requests
+from openvino._pyopenvino.properties import cache_hits
+from openvino._pyopenvino.properties import cache_misses
+from openvino._pyopenvino.properties import cache_evictions
 
 # Submodules
 from openvino.runtime.properties import hint
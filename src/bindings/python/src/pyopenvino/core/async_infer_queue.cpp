@@ -9,6 +9,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -51,37 +52,86 @@ public:
         std::lock_guard<std::mutex> lock(m_mutex);
         if (m_errors.size() > 0)
             throw m_errors.front();
-        return !(m_idle_handles.empty());
+        // the finished requests of the batched mode are idle as soon as their callbacks are run
+        return !(m_idle_handles.empty()) || !m_completed_handles.empty();
     }
 
     size_t get_idle_request_id() {
-        // Wait for any request to complete and return its id
-        // release GIL to avoid deadlock on python callback
-        py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
-        // wait for request to make sure it returned from callback
-        m_requests[idle_handle].m_request.wait();
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return idle_handle;
+        while (true) {
+            {
+                // Wait for any request to complete and return its id
+                // release GIL to avoid deadlock on python callback
+                py::gil_scoped_release release;
+                // acquire the mutex to access m_errors and m_idle_handles
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] {
+                    return !(m_idle_handles.empty()) || !m_completed_handles.empty();
+                });
+                if (!m_idle_handles.empty()) {
+                    size_t idle_handle = m_idle_handles.front();
+                    // wait for request to make sure it returned from callback
+                    m_requests[idle_handle].m_request.wait();
+                    if (m_errors.size() > 0)
+                        throw m_errors.front();
+                    return idle_handle;
+                }
+            }
+            // In the batched mode the finished requests become idle after their callbacks are run here
+            poll(0);
+        }
     }
 
     void wait_all() {
-        // Wait for all request to complete
-        // release GIL to avoid deadlock on python callback
-        py::gil_scoped_release release;
-        for (auto&& request : m_requests) {
-            request.m_request.wait();
+        {
+            // Wait for all request to complete
+            // release GIL to avoid deadlock on python callback
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                request.m_request.wait();
+            }
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_errors.size() > 0)
+                throw m_errors.front();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        // Run the callbacks of the requests finished in the batched mode
+        poll(0);
+    }
+
+    size_t poll(size_t max_count) {
+        // The GIL is held by the calling thread, so it is acquired once for the whole batch
+        size_t count = 0;
+        while (max_count == 0 || count < max_count) {
+            size_t handle = 0;
+            {
+                // acquire the mutex to access m_completed_handles
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_completed_handles.empty())
+                    break;
+                handle = m_completed_handles.front();
+                m_completed_handles.pop();
+            }
+            count++;
+            try {
+                m_batched_callback(m_requests[handle], m_user_ids[handle]);
+            } catch (...) {
+                release_handle(handle);
+                throw;
+            }
+            release_handle(handle);
+        }
+        return count;
+    }
+
+    void release_handle(size_t handle) {
+        {
+            // acquire the mutex to access m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // Add idle handle to queue
+            m_idle_handles.push(handle);
+        }
+        // Notify locks in getIdleRequestId()
+        m_cv.notify_one();
     }
 
     void set_default_callbacks() {
@@ -151,6 +201,36 @@ public:
         }
     }
 
+    void set_batched_callbacks(py::function f_callback) {
+        m_batched_callback = f_callback;
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            // The callback doesn't touch Python objects, so it doesn't acquire GIL
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                {
+                    // acquire the mutex to access m_idle_handles and m_completed_handles
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (exception_ptr == nullptr) {
+                        // The Python callback is run by the thread which polls the completed handles
+                        m_completed_handles.push(handle);
+                    } else {
+                        m_idle_handles.push(handle);
+                    }
+                }
+                // Notify locks in getIdleRequestId()
+                m_cv.notify_one();
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -159,6 +239,9 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    // handles of the requests finished in the batched mode whose callbacks are not run yet
+    std::queue<size_t> m_completed_handles;
+    py::function m_batched_callback;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -298,9 +381,17 @@ void regclass_AsyncInferQueue(py::module m) {
             :rtype: int
         )");
 
-    cls.def("set_callback",
-            &AsyncInferQueue::set_custom_callbacks,
-            R"(
+    cls.def(
+        "set_callback",
+        [](AsyncInferQueue& self, py::function callback, bool batched) {
+            if (batched)
+                self.set_batched_callbacks(callback);
+            else
+                self.set_custom_callbacks(callback);
+        },
+        py::arg("callback"),
+        py::arg("batched") = false,
+        R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
             first one is InferRequest object and second one is userdata
@@ -314,8 +405,37 @@ void regclass_AsyncInferQueue(py::module m) {
 
                 async_infer_queue.set_callback(f)
 
+            By default the callback is run by the thread which completes the request
+            and it acquires GIL for every request. In the batched mode the finished
+            requests are queued and the callbacks are run by the Python thread which
+            calls `poll`, `start_async`, `get_idle_request_id` or `wait_all`, so GIL
+            isn't acquired by the completion threads. The request is idle after its
+            callback is run.
+
+            In the batched mode an exception raised by the callback isn't stored to be
+            raised by the later calls, it is raised by the `poll`, `start_async`,
+            `get_idle_request_id` or `wait_all` call which runs the callback. The
+            `start_async` call which raises it this way hasn't started its job.
+
             :param callback: Any Python defined function that matches callback's requirements.
             :type callback: function
+            :param batched: Enables the batched mode. Default: False
+            :type batched: bool
+        )");
+
+    cls.def("poll",
+            &AsyncInferQueue::poll,
+            py::arg("max_count") = 0,
+            R"(
+            One of 'flow control' functions. Non-blocking call.
+            Runs the callbacks of the requests finished in the batched mode
+            in the calling thread and makes these requests idle.
+
+            :param max_count: Maximal number of the callbacks to run. If 0, the callbacks
+            of all finished requests are run. Default: 0
+            :type max_count: int
+            :return: Number of the run callbacks.
+            :rtype: int
         )");
 
     cls.def(
@@ -25,12 +25,15 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::enable_profiling, "enable_profiling");
     wrap_property_RW(m_properties, ov::cache_dir, "cache_dir");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
+    wrap_property_RW(m_properties, ov::auto_batch_sub_batches, "auto_batch_sub_batches");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
     wrap_property_RW(m_properties, ov::affinity, "affinity");
     wrap_property_RW(m_properties, ov::force_tbb_terminate, "force_tbb_terminate");
     wrap_property_RW(m_properties, ov::enable_mmap, "enable_mmap");
+    wrap_property_RW(m_properties, ov::cache_max_size, "cache_max_size");
+    wrap_property_RW(m_properties, ov::cache_memory_max_size, "cache_memory_max_size");
 
     wrap_property_RO(m_properties, ov::supported_properties, "supported_properties");
     wrap_property_RO(m_properties, ov::available_devices, "available_devices");
@@ -40,6 +43,10 @@ void regmodule_properties(py::module m) {
     wrap_property_RO(m_properties, ov::optimal_batch_size, "optimal_batch_size");
     wrap_property_RO(m_properties, ov::max_batch_size, "max_batch_size");
     wrap_property_RO(m_properties, ov::range_for_async_infer_requests, "range_for_async_infer_requests");
+    wrap_property_RO(m_properties, ov::cache_hits, "cache_hits");
+    wrap_property_RO(m_properties, ov::cache_misses, "cache_misses");
+    wrap_property_RO(m_properties, ov::cache_evictions, "cache_evictions");
+    wrap_property_RO(m_properties, ov::auto_batch_fill_rate, "auto_batch_fill_rate");
 
     // Submodule hint
     py::module m_hint =
@@ -91,6 +98,12 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_intel_cpu,
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::shared_streams_cache, "shared_streams_cache");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::sticky_streams, "sticky_streams");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::shape_cache_hits, "shape_cache_hits");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::shape_cache_misses, "shape_cache_misses");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::memory_workspace_size, "memory_workspace_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::memory_fragmentation, "memory_fragmentation");
 
     // Submodule intel_gpu
     py::module m_intel_gpu =
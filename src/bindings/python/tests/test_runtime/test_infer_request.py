@@ -8,6 +8,7 @@ import numpy as np
 import os
 import pytest
 import datetime
+import threading
 import time
 
 import openvino.runtime.opset12 as ops
@@ -654,6 +655,76 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+def test_infer_queue_batched_callback(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    model = core.read_model(test_net_xml, test_net_bin)
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [{"finished": False, "thread": None} for _ in range(jobs)]
+
+    def callback(request, job_id):
+        jobs_done[job_id]["finished"] = True
+        jobs_done[job_id]["thread"] = threading.get_ident()
+
+    img = generate_image()
+    infer_queue.set_callback(callback, batched=True)
+    assert infer_queue.is_ready()
+
+    for i in range(jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    assert all(job["finished"] for job in jobs_done)
+    # the callbacks are run by the thread which drains the completion queue
+    assert all(job["thread"] == threading.get_ident() for job in jobs_done)
+    assert infer_queue.poll() == 0
+
+
+def test_infer_queue_poll(device):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    queue = AsyncInferQueue(compiled_model, 2)
+    finished = []
+
+    queue.set_callback(lambda request, userdata: finished.append(userdata), batched=True)
+    for i in range(len(queue)):
+        queue.start_async(userdata=i)
+    for request in queue:
+        request.wait()
+
+    # the requests are not idle until their callbacks are run
+    assert finished == []
+    assert queue.poll(1) == 1
+    assert queue.poll() == 1
+    assert queue.poll() == 0
+    assert sorted(finished) == [0, 1]
+
+    idle_id = queue.get_idle_request_id()
+    assert queue[idle_id].wait_for(0)
+
+
+def test_infer_queue_batched_callback_fail(device):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    queue = AsyncInferQueue(compiled_model, 1)
+
+    def callback(request, _):
+        request = request + 21
+
+    queue.set_callback(callback, batched=True)
+    queue.start_async()
+    with pytest.raises(TypeError) as e:
+        queue.wait_all()
+    assert "unsupported operand type(s) for +" in str(e.value)
+    # the request is idle even if its callback fails
+    assert queue.is_ready()
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
@@ -153,6 +153,10 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (properties.optimal_batch_size, "OPTIMAL_BATCH_SIZE"),
         (properties.max_batch_size, "MAX_BATCH_SIZE"),
         (properties.range_for_async_infer_requests, "RANGE_FOR_ASYNC_INFER_REQUESTS"),
+        (properties.cache_hits, "CACHE_HITS"),
+        (properties.cache_misses, "CACHE_MISSES"),
+        (properties.cache_evictions, "CACHE_EVICTIONS"),
+        (properties.auto_batch_fill_rate, "AUTO_BATCH_FILL_RATE"),
         (properties.device.full_name, "FULL_DEVICE_NAME"),
         (properties.device.architecture, "DEVICE_ARCHITECTURE"),
         (properties.device.type, "DEVICE_TYPE"),
@@ -160,6 +164,10 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (properties.device.thermal, "DEVICE_THERMAL"),
         (properties.device.uuid, "DEVICE_UUID"),
         (properties.device.capabilities, "OPTIMIZATION_CAPABILITIES"),
+        (properties.intel_cpu.shape_cache_hits, "CPU_SHAPE_CACHE_HITS"),
+        (properties.intel_cpu.shape_cache_misses, "CPU_SHAPE_CACHE_MISSES"),
+        (properties.intel_cpu.memory_workspace_size, "CPU_MEMORY_WORKSPACE_SIZE"),
+        (properties.intel_cpu.memory_fragmentation, "CPU_MEMORY_FRAGMENTATION"),
         (properties.intel_gpu.device_total_mem_size, "GPU_DEVICE_TOTAL_MEM_SIZE"),
         (properties.intel_gpu.uarch_version, "GPU_UARCH_VERSION"),
         (properties.intel_gpu.execution_units_count, "GPU_EXECUTION_UNITS_COUNT"),
@@ -202,6 +210,7 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (properties.auto_batch_sub_batches, "AUTO_BATCH_SUB_BATCHES", ((2, 2), (0, 0))),
         (
             properties.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -222,6 +231,8 @@ def test_properties_ro(ov_property_ro, expected_value):
         ),
         (properties.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True), (False, False))),
         (properties.enable_mmap, "ENABLE_MMAP", ((True, True), (False, False))),
+        (properties.cache_max_size, "CACHE_MAX_SIZE", ((1 << 30, 1 << 30), (0, 0))),
+        (properties.cache_memory_max_size, "CACHE_MEMORY_MAX_SIZE", ((1 << 20, 1 << 20), (0, 0))),
         (properties.hint.inference_precision, "INFERENCE_PRECISION_HINT", ((Type.f32, Type.f32),)),
         (
             properties.hint.model_priority,
@@ -278,6 +289,16 @@ def test_properties_ro(ov_property_ro, expected_value):
             "CPU_DENORMALS_OPTIMIZATION",
             ((True, True),),
         ),
+        (
+            properties.intel_cpu.shared_streams_cache,
+            "CPU_SHARED_STREAMS_CACHE",
+            ((True, True),),
+        ),
+        (
+            properties.intel_cpu.sticky_streams,
+            "CPU_STICKY_STREAMS",
+            ((True, True),),
+        ),
         (
             properties.intel_cpu.sparse_weights_decompression_rate,
             "CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE",
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <fstream>
 #include <memory>
 #include <string>
 
@@ -58,4 +59,33 @@ std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path,
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
+/**
+ * @brief This class represents a file stream which content is also mapped to memory.
+ * It can be read as a regular std::ifstream, while consumers aware of it can access
+ * the file content directly via the mapped memory and avoid copying it.
+ */
+class MmapStream final : public std::ifstream {
+public:
+    /**
+     * @brief Opens a file stream over an already mapped file.
+     *
+     * @param path Path to the mapped file.
+     * @param memory Mapped memory of the whole file, its lifetime can be extended by stream consumers.
+     */
+    MmapStream(const std::string& path, std::shared_ptr<ov::MappedMemory> memory)
+        : std::ifstream(path, std::ios_base::binary),
+          m_memory(std::move(memory)) {}
+
+    /**
+     * @brief Returns the mapped memory of the whole file.
+     * Offsets in the mapped memory are equal to the positions in the stream.
+     */
+    const std::shared_ptr<ov::MappedMemory>& memory() const noexcept {
+        return m_memory;
+    }
+
+private:
+    std::shared_ptr<ov::MappedMemory> m_memory;
+};
+
 }  // namespace ov
@@ -58,6 +58,9 @@ public:
 class MapHolder : public MappedMemory {
     void* m_data = MAP_FAILED;
     size_t m_size = 0;
+    // the mapping itself starts at the page boundary before the requested offset
+    void* m_mapped_data = MAP_FAILED;
+    size_t m_mapped_size = 0;
     HandleHolder m_handle;
 
 public:
@@ -86,11 +89,12 @@ public:
         // move pointer to the expected data (after alignment with page size)
         const size_t offset_delta = offset - aligned_offset;
         if (aligned_size > 0) {
-            m_data = mmap(nullptr, aligned_size, prot, MAP_PRIVATE, m_handle.get(), aligned_offset);
-            if (m_data == MAP_FAILED) {
+            m_mapped_data = mmap(nullptr, aligned_size, prot, MAP_PRIVATE, m_handle.get(), aligned_offset);
+            if (m_mapped_data == MAP_FAILED) {
                 throw std::runtime_error("Can not create file mapping for " + path + ", err=" + std::strerror(errno));
             }
-            m_data = reinterpret_cast<char*>(m_data) + offset_delta;
+            m_mapped_size = aligned_size;
+            m_data = reinterpret_cast<char*>(m_mapped_data) + offset_delta;
         } else {
             m_size = 0;
             m_data = MAP_FAILED;
@@ -98,8 +102,8 @@ public:
     }
 
     ~MapHolder() {
-        if (m_data != MAP_FAILED) {
-            munmap(m_data, m_size);
+        if (m_mapped_data != MAP_FAILED) {
+            munmap(m_mapped_data, m_mapped_size);
         }
     }
 
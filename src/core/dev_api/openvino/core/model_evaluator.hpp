@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+
+/// \brief Prepared evaluation of a model, which is built once and evaluates the model many times.
+///
+/// The nodes are evaluated in the precomputed topological order and the values are kept in slots addressed
+/// by index. The intermediate tensors of static shapes are views into a set of buffers, which are shared by
+/// the values with disjoint lifetimes and are reused by every evaluation.
+///
+/// The evaluator keeps the nodes of the model alive, but it doesn't track model changes, so it must be
+/// rebuilt after the model is modified. It is not thread safe, use an evaluator per thread.
+///
+/// Model::evaluate keeps an evaluator of the model, which is rebuilt when the topology or the output shapes
+/// and types of the nodes change.
+class OPENVINO_API ModelEvaluator {
+public:
+    explicit ModelEvaluator(const Model& model);
+
+    /// \brief Evaluates the model.
+    /// \param output_tensors Tensors for the model results. Tensors with dynamic shapes are replaced by the
+    /// allocated ones.
+    /// \param input_tensors Tensors for the model parameters.
+    /// \param evaluation_context Storage of additional settings and attributes, it gets the VariableContext.
+    /// \return true if the model is evaluated.
+    bool evaluate(TensorVector& output_tensors,
+                  const TensorVector& input_tensors,
+                  EvaluationContext& evaluation_context);
+
+    bool evaluate(TensorVector& output_tensors, const TensorVector& input_tensors);
+
+    /// \brief Returns the number of bytes allocated for the intermediate tensors of static shapes.
+    size_t get_buffers_byte_size() const;
+
+private:
+    friend class Model;
+
+    /// \brief Checks the output shapes and types of the nodes are the ones the evaluation is planned for.
+    bool is_up_to_date() const;
+
+    /// \brief Stops keeping the nodes alive, so the evaluator cached by the model doesn't hold the removed nodes.
+    /// The evaluator may be used only while the topology of the model is not changed.
+    void release_nodes();
+
+    struct Step {
+        Node* node;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+        std::vector<element::Type> output_types;
+        std::vector<PartialShape> output_shapes;
+        // values which are not used after the step
+        std::vector<size_t> released;
+    };
+
+    std::vector<std::shared_ptr<Node>> m_nodes;
+    std::vector<Step> m_steps;
+    std::vector<size_t> m_parameter_slots;
+    std::vector<size_t> m_result_slots;
+    // preallocated tensors of the constants and of the intermediate values with static shapes,
+    // the other slots are empty and get the tensors during evaluation
+    std::vector<Tensor> m_planned_values;
+    std::vector<Tensor> m_buffers;
+    std::vector<Tensor> m_values;
+    TensorVector m_step_inputs;
+    TensorVector m_step_outputs;
+};
+
+}  // namespace ov
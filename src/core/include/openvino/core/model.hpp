@@ -35,6 +35,7 @@ class FrontEnd;
 }
 
 class ModelAccessor;
+class ModelEvaluator;
 
 /**
  * @brief A user-defined model
@@ -177,6 +178,14 @@ public:
 
     void validate_nodes_and_infer_types() const;
 
+    /// \brief Validates the nodes which are changed since the last validation of the model and the nodes
+    /// which depend on them.
+    ///
+    /// The changed nodes are the nodes whose inputs were replaced or which were added to the model. The
+    /// attributes changed in place are not tracked, use validate_nodes_and_infer_types after such changes.
+    /// \returns The number of the validated nodes.
+    size_t validate_changed_nodes_and_infer_types() const;
+
     /// \brief Returns the sum of the size of all nodes in the graph plus the size of
     /// all constant data. This has little value beyond comparing the relative size of
     /// graphs and should not be considered the actual memory consumption of a graph.
@@ -582,6 +591,11 @@ private:
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
 
     mutable std::mutex m_model_mutex;
+
+    // Evaluation plan reused by the evaluate calls while the topology of the model and the shapes are not changed
+    mutable std::shared_ptr<ModelEvaluator> m_evaluator;
+    mutable size_t m_evaluator_topology_version{0};
+    mutable std::mutex m_evaluator_mutex;
 };
 
 OPENVINO_API
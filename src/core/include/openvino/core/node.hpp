@@ -482,7 +482,8 @@ private:
     // can be executed into multiple threads means that m_shared_rt_info
     // can be updated simultaneously, so we have to guaranty exclusive
     // update of this field by having specific method with mutex.
-    void insert_info(std::shared_ptr<SharedRTInfo> info);
+    // Returns true if the node didn't have this info.
+    bool insert_info(std::shared_ptr<SharedRTInfo> info);
     std::mutex m_insert_mutex;
 };
 
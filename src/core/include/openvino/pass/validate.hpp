@@ -21,6 +21,10 @@ namespace pass {
 /// pass does not break the shape and data type requirement on a computation node.
 /// This default validation run can be changed via calling the
 /// \link ov::pass::Manager::set_per_pass_validation(bool) \endlink function.
+/// The Manager validates only the nodes changed since the previous validation and the nodes
+/// which depend on them, except for its last validation, which validates all the nodes. If
+/// the last Validate pass is skipped after some incremental validations, all the nodes are
+/// validated at the end of the run.
 /// \ingroup ov_pass_cpp_api
 class OPENVINO_API Validate : public ModelPass {
 public:
@@ -10,6 +10,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -65,6 +66,65 @@ inline void numpy_autobroadcast_binop(const T* arg0,
     }
 }
 
+/// \brief Runs numpy_autobroadcast_binop in parallel.
+///
+/// The whole output is one block if all the dims up to the axis are 1, the block is split between the threads.
+/// Otherwise the threads get the slices of the first dim which is not 1, the slices are independent.
+template <int A0, int A1, typename T, typename U, typename Functor>
+inline void parallel_numpy_autobroadcast_binop(const T* arg0,
+                                               const T* arg1,
+                                               U* out,
+                                               const Shape& shape0,
+                                               const Shape& shape1,
+                                               const size_t* strides0,
+                                               const size_t* strides1,
+                                               const size_t padding0,
+                                               const size_t padding1,
+                                               const Shape& output_shape,
+                                               const size_t axis,
+                                               const size_t stride,
+                                               Functor elementwise_functor) {
+    size_t dim = 0;
+    while (dim <= axis && output_shape[dim] == 1)
+        ++dim;
+
+    if (dim > axis) {
+        parallel_for_chunks(stride, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                out[i] = elementwise_functor(arg0[i * A0], arg1[i * A1]);
+        });
+        return;
+    }
+
+    const size_t slices = output_shape[dim];
+    if (slices == 0)
+        return;
+    const size_t slice_size = shape_size(output_shape) / slices;
+    const size_t slice_stride0 = value_with_padding_or(shape0, padding0, dim, 1) == 1 ? 0 : strides0[dim];
+    const size_t slice_stride1 = value_with_padding_or(shape1, padding1, dim, 1) == 1 ? 0 : strides1[dim];
+    parallel_for_chunks(
+        slices,
+        [&](size_t begin, size_t end) {
+            Shape slice_shape(output_shape);
+            slice_shape[dim] = 1;
+            for (size_t i = begin; i < end; ++i)
+                numpy_autobroadcast_binop<A0, A1>(arg0 + i * slice_stride0,
+                                                  arg1 + i * slice_stride1,
+                                                  out + i * slice_size,
+                                                  shape0,
+                                                  shape1,
+                                                  strides0,
+                                                  strides1,
+                                                  padding0,
+                                                  padding1,
+                                                  slice_shape,
+                                                  axis,
+                                                  stride,
+                                                  elementwise_functor);
+        },
+        std::max<size_t>(parallel_min_chunk / std::max<size_t>(slice_size, 1), 1));
+}
+
 inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
     while (axis > 0 && strides[axis - 1] == 1)
         --axis;
@@ -99,9 +159,11 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
-        }
+        parallel_for_chunks(shape_size(arg0_shape), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
+            }
+        });
         break;
     case op::AutoBroadcastType::NUMPY:
         // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -157,54 +219,56 @@ void autobroadcast_binop(const T* arg0,
             }
 
             if (axis == 0) {
-                for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                parallel_for_chunks(strides0[0], [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                        out[i] = elementwise_functor(arg0[i], arg1[i]);
+                });
             } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
                 axis = calculate_fixed_axis(axis, strides0);
 
-                numpy_autobroadcast_binop<0, 1>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides1[axis],
-                                                elementwise_functor);
+                parallel_numpy_autobroadcast_binop<0, 1>(arg0,
+                                                         arg1,
+                                                         out,
+                                                         arg0_shape,
+                                                         arg1_shape,
+                                                         strides0,
+                                                         strides1,
+                                                         padding0,
+                                                         padding1,
+                                                         output_shape,
+                                                         axis,
+                                                         strides1[axis],
+                                                         elementwise_functor);
             } else if (strides1[axis] == 1 && value_with_padding_or(arg1_shape, padding1, axis, 1) == 1) {
                 axis = calculate_fixed_axis(axis, strides1);
 
-                numpy_autobroadcast_binop<1, 0>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides0[axis],
-                                                elementwise_functor);
+                parallel_numpy_autobroadcast_binop<1, 0>(arg0,
+                                                         arg1,
+                                                         out,
+                                                         arg0_shape,
+                                                         arg1_shape,
+                                                         strides0,
+                                                         strides1,
+                                                         padding0,
+                                                         padding1,
+                                                         output_shape,
+                                                         axis,
+                                                         strides0[axis],
+                                                         elementwise_functor);
             } else
-                numpy_autobroadcast_binop<1, 1>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides0[axis],
-                                                elementwise_functor);
+                parallel_numpy_autobroadcast_binop<1, 1>(arg0,
+                                                         arg1,
+                                                         out,
+                                                         arg0_shape,
+                                                         arg1_shape,
+                                                         strides0,
+                                                         strides1,
+                                                         padding0,
+                                                         padding1,
+                                                         output_shape,
+                                                         axis,
+                                                         strides0[axis],
+                                                         elementwise_functor);
         }
         break;
     case op::AutoBroadcastType::PDPD:
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -79,25 +81,32 @@ template <typename TI, typename TO>
 void lp_convert(const TI* arg, TO* out, size_t count, element::Type_t src_type, element::Type_t dst_type) {
     const uint8_t* input = reinterpret_cast<const uint8_t*>(arg);
     uint8_t* output = reinterpret_cast<uint8_t*>(out);
-    for (size_t i = 0; i < count; ++i) {
-        if (dst_type == element::u1) {
-            detail::set_u1(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
-        } else if (dst_type == element::u4) {
-            detail::set_u4(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
-        } else if (dst_type == element::i4) {
-            detail::set_i4(output, i, detail::get_value<int8_t, TI>(input, i, src_type));
-        } else {
-            out[i] = detail::get_value<TO, TI>(input, i, src_type);
+    // the threads get whole bytes of the packed output, a byte holds 8 elements of u1 at most
+    constexpr size_t block = 8;
+    parallel_for_chunks((count + block - 1) / block, [&](size_t begin, size_t end) {
+        const auto last = std::min(end * block, count);
+        for (size_t i = begin * block; i < last; ++i) {
+            if (dst_type == element::u1) {
+                detail::set_u1(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
+            } else if (dst_type == element::u4) {
+                detail::set_u4(output, i, detail::get_value<uint8_t, TI>(input, i, src_type));
+            } else if (dst_type == element::i4) {
+                detail::set_i4(output, i, detail::get_value<int8_t, TI>(input, i, src_type));
+            } else {
+                out[i] = detail::get_value<TO, TI>(input, i, src_type);
+            }
         }
-    }
+    }, parallel_min_chunk / block);
 }
 }  // namespace detail
 
 template <typename TI, typename TO>
 typename std::enable_if<!std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<TO>(arg[i]);
-    }
+    parallel_for_chunks(count, [arg, out](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<TO>(arg[i]);
+        }
+    });
 }
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
@@ -118,9 +127,11 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count);
 // overload to handle ngraph::boolean (it is stored as char)
 template <typename TI, typename TO>
 typename std::enable_if<std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-    }
+    parallel_for_chunks(count, [arg, out](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+        }
+    });
 }
 
 }  // namespace reference
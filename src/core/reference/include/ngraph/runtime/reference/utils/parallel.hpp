@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief The minimal number of elements processed by a thread of the elementwise reference kernels.
+constexpr size_t parallel_min_chunk = 1 << 15;
+
+/// \brief Splits the range [0, work_amount) into contiguous chunks and calls func(begin, end) for every chunk
+/// in parallel. The work is done by the calling thread if it has less than two chunks of min_chunk items.
+///
+/// The reference kernels are templates instantiated in the libraries without threading, so the
+/// threading is hidden in this function of the reference library. The exception thrown by func is
+/// rethrown in the calling thread.
+///
+/// \param work_amount Number of the work items.
+/// \param func Function processing the items in [begin, end).
+/// \param min_chunk Minimal number of items processed by a thread.
+void parallel_for_chunks(size_t work_amount,
+                         const std::function<void(size_t, size_t)>& func,
+                         size_t min_chunk = parallel_min_chunk);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -82,10 +82,20 @@ void reshape_in2(const char* in,
             }
         }
     } else {
-        ov::parallel_for2d(out_shape[0], out_shape[1], [in, out, &out_shape, elem_size](size_t i, size_t j) {
-            size_t in_off = j * out_shape[0] + i;
-            size_t out_off = i * out_shape[1] + j;
-            copy_element(out + out_off * elem_size, in + in_off * elem_size, elem_size);
+        // the threads transpose the square tiles, so both the reads and the writes of a tile stay in cache
+        constexpr size_t tile = 32;
+        const size_t rows = out_shape[0];
+        const size_t cols = out_shape[1];
+        ov::parallel_for2d((rows + tile - 1) / tile, (cols + tile - 1) / tile, [&](size_t ti, size_t tj) {
+            const size_t i_end = std::min(rows, (ti + 1) * tile);
+            const size_t j_end = std::min(cols, (tj + 1) * tile);
+            for (size_t i = ti * tile; i < i_end; i++) {
+                for (size_t j = tj * tile; j < j_end; j++) {
+                    size_t in_off = j * rows + i;
+                    size_t out_off = i * cols + j;
+                    copy_element(out + out_off * elem_size, in + in_off * elem_size, elem_size);
+                }
+            }
         });
     }
 }
@@ -6,6 +6,8 @@
 
 #include <cstring>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
@@ -30,20 +32,41 @@ void concat(const std::vector<const char*>& args,
     for (int i = 0; i < concatenation_axis; ++i) {
         steps *= out_shape[i];
     }
+    const size_t out_size = shape_size(out_shape);
+    if (out_size == 0)
+        return;
 
+    // the inputs take the consecutive parts [offsets[i], offsets[i + 1]) of every output step
     const auto& shape_sizes = calculate_shape_sizes(in_shapes);
+    std::vector<size_t> offsets(args.size() + 1, 0);
+    for (size_t in_index = 0; in_index < args.size(); ++in_index) {
+        offsets[in_index + 1] = offsets[in_index] + shape_sizes[in_index] / steps;
+    }
+    const size_t out_step_size = offsets.back();
 
-    size_t out_offset = 0;
-    for (size_t step = 0; step < steps; ++step) {
-        for (size_t in_index = 0; in_index < args.size(); ++in_index) {
-            const size_t size = shape_sizes[in_index] / steps;
-            const size_t in_offset = step * size;
+    // the output is split between the threads evenly, so the large inputs are copied by several threads
+    parallel_for_chunks(out_size, [&](size_t begin, size_t end) {
+        size_t step = begin / out_step_size;
+        size_t pos = begin % out_step_size;
+        size_t in_index = 0;
+        while (begin < end) {
+            while (offsets[in_index + 1] <= pos)
+                ++in_index;
+            const size_t size = std::min(offsets[in_index + 1] - pos, end - begin);
+            const size_t in_step_size = offsets[in_index + 1] - offsets[in_index];
+            const size_t in_offset = step * in_step_size + pos - offsets[in_index];
 
-            std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
+            std::memcpy(&out[begin * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
 
-            out_offset += size;
+            begin += size;
+            pos += size;
+            if (pos == out_step_size) {
+                pos = 0;
+                in_index = 0;
+                ++step;
+            }
         }
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -7,27 +7,22 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <numeric>
 
 #include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
 namespace {
-/// \brief For each axis calculates the product of inner axes
-/// If dims has shape (2, 3, 4) then for 2 (first axis) the inner axes would be (3, 4)
-/// and for 3 (second axis) it would be (4)
-/// If dims has shape(2, 3, 4) then the output vector would be (3 * 4, 4, 1)
-/// The outermost axis is not used. For innermost axis it is always 1.
-/// \param[in] dims Shape of the output
-///
-/// \return Vector containing calculated values for each axis.
-std::vector<int64_t> create_pitches(const Shape& dims) {
-    std::vector<int64_t> pitch;
-    pitch.resize(dims.size() - 1);
-    std::partial_sum(dims.rbegin(), dims.rend() - 1, pitch.rbegin(), std::multiplies<int64_t>());
-    pitch.push_back(1);
-    return pitch;
+/// \brief Fills the row by the copies of its first block_size bytes, the copied part doubles at every step.
+void repeat_block(char* row, size_t block_size, size_t row_size) {
+    for (size_t filled = block_size; filled < row_size;) {
+        const auto size = std::min(filled, row_size - filled);
+        memcpy(row + filled, row, size);
+        filled += size;
+    }
 }
 }  // namespace
 
@@ -39,52 +34,50 @@ void runtime::reference::tile(const char* arg,
                               const std::vector<int64_t>& repeats) {
     Shape in_shape_expanded(in_shape);
     in_shape_expanded.insert(in_shape_expanded.begin(), out_shape.size() - in_shape.size(), 1);
-    size_t block_size = 0;
-    int64_t num_repeats = 0;
-    const int input_rank = static_cast<int>(in_shape_expanded.size());
-    const int64_t last_dim = in_shape_expanded[input_rank - 1];
-    const std::vector<int64_t> pitches = create_pitches(out_shape);
-    const char* copy = nullptr;
-
-    std::vector<size_t> indices(in_shape_expanded.size() - 1, 0);
-    size_t axis = indices.size();
 
     if (std::all_of(repeats.begin(), repeats.end(), [](int64_t repeat) {
             return repeat == 0;
         })) {
         return;
     }
+    if (shape_size(out_shape) == 0)
+        return;
 
-    // Copy and repeat data for innermost axis as many times as described in the repeats parameter
-    while (axis <= indices.size()) {
-        block_size = last_dim * elem_size;
-        memcpy(out, arg, block_size);
-        out += block_size;
-        arg += block_size;
+    // the output rows (the innermost axis) are independent: every row is the input row repeated along the
+    // innermost axis, the input row is found by the coordinates of the output row modulo the input shape
+    const size_t outer_rank = out_shape.size() - 1;
+    const size_t in_row_size = in_shape_expanded.back() * elem_size;
+    const size_t out_row_size = out_shape.back() * elem_size;
+    const size_t rows = shape_size(out_shape) / out_shape.back();
 
-        copy = out - block_size;
-        num_repeats = repeats[input_rank - 1] - 1;
-        for (int64_t i = 0; i < num_repeats; ++i) {
-            memcpy(out, copy, block_size);
-            out += block_size;
-        }
+    std::vector<size_t> in_row_pitches(outer_rank, 1);
+    for (size_t axis = outer_rank; axis-- > 1;)
+        in_row_pitches[axis - 1] = in_row_pitches[axis] * in_shape_expanded[axis];
 
-        // Copy and repeat data for other axes as many times as described in the repeats parameter
-        while (axis-- != 0) {
-            if (++indices[axis] != in_shape_expanded[axis]) {
-                axis = indices.size();
-                break;
+    parallel_for_chunks(
+        rows,
+        [&](size_t begin, size_t end) {
+            std::vector<size_t> indices(outer_rank, 0);
+            for (size_t axis = outer_rank, row = begin; axis-- > 0;) {
+                indices[axis] = row % out_shape[axis];
+                row /= out_shape[axis];
             }
-            indices[axis] = 0;
 
-            ptrdiff_t pitch = pitches[axis] * in_shape_expanded[axis];
-            block_size = pitch * elem_size;
-            copy = out - block_size;
-            num_repeats = repeats[axis] - 1;
-            for (int64_t i = 0; i < num_repeats; i++) {
-                memcpy(out, copy, block_size);
-                out += block_size;
+            for (size_t row = begin; row < end; ++row) {
+                size_t in_row = 0;
+                for (size_t axis = 0; axis < outer_rank; ++axis)
+                    in_row += indices[axis] % in_shape_expanded[axis] * in_row_pitches[axis];
+
+                char* out_row = out + row * out_row_size;
+                memcpy(out_row, arg + in_row * in_row_size, in_row_size);
+                repeat_block(out_row, in_row_size, out_row_size);
+
+                for (size_t axis = outer_rank; axis-- > 0;) {
+                    if (++indices[axis] < out_shape[axis])
+                        break;
+                    indices[axis] = 0;
+                }
             }
-        }
-    }
+        },
+        std::max<size_t>(parallel_min_chunk / std::max<size_t>(out_shape.back(), 1), 1));
 }
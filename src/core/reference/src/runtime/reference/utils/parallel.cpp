@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+void parallel_for_chunks(size_t work_amount,
+                         const std::function<void(size_t, size_t)>& func,
+                         size_t min_chunk) {
+    if (work_amount == 0)
+        return;
+
+    const auto max_threads = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+    const auto nthr = std::min(max_threads, work_amount / std::max<size_t>(min_chunk, 1));
+    if (nthr < 2) {
+        func(0, work_amount);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(nthr);
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int team) {
+        size_t begin = 0, end = 0;
+        ov::splitter(work_amount, static_cast<size_t>(team), static_cast<size_t>(ithr), begin, end);
+        if (begin >= end)
+            return;
+        try {
+            func(begin, end);
+        } catch (...) {
+            errors[ithr] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
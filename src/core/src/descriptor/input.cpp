@@ -41,10 +41,12 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
 
     // Output replacement may change the topological order of nodes,
     // so we have to reset cache by setting a flag into shared node info.
+    // The node has to be validated again, as its input is changed.
     for_each(m_node->m_shared_rt_info.cbegin(),
              m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
+             [this](const std::shared_ptr<SharedRTInfo>& info) {
                  info->set_use_topological_cache(false);
+                 info->mark_as_changed(m_node);
              });
 }
 
@@ -10,7 +10,6 @@
 
 #include "itt.hpp"
 #include "layout_utils.hpp"
-#include "ngraph/evaluator.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -20,6 +19,7 @@
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/model_evaluator.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/util/op_types.hpp"
@@ -88,6 +88,63 @@ ngraph::ParameterVector auto_detect_parameters(const std::vector<std::shared_ptr
     return parameter_vector;
 }
 
+// Checks the model after the nodes validation: the parameters and the variables are registered,
+// Assign and ReadValue operations are in pairs and the results are compatible with their layouts.
+void check_validated_model(const std::vector<shared_ptr<ov::Node>>& ordered_ops,
+                           const ngraph::ParameterVector& parameters,
+                           const ov::op::util::VariableVector& variables,
+                           const std::vector<ov::Output<const ov::Node>>& outputs) {
+    struct Counter {
+        int cnt_assign = 0;
+        int cnt_read_val = 0;
+    };
+    std::map<ov::op::util::Variable*, Counter> pair_checker;
+    std::stringstream unregistered_parameters;
+    std::stringstream unregistered_variables;
+
+    for (auto& node : ordered_ops) {
+        if (ov::op::util::is_parameter(node) &&
+            std::find(parameters.begin(), parameters.end(), node) == parameters.end())
+            unregistered_parameters << node << std::endl;
+
+        const auto& variable_op = dynamic_pointer_cast<ov::op::util::VariableExtension>(node);
+        if (variable_op &&
+            std::find(variables.begin(), variables.end(), variable_op->get_variable()) == variables.end())
+            unregistered_variables << variable_op->get_variable_id() << std::endl;
+
+        if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(node)) {
+            pair_checker[assign->get_variable().get()].cnt_assign++;
+        } else if (const auto& read_value = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(node)) {
+            pair_checker[read_value->get_variable().get()].cnt_read_val++;
+        }
+    }
+
+    OPENVINO_ASSERT(unregistered_parameters.str().empty(),
+                    "Model references undeclared parameters: ",
+                    unregistered_parameters.str());
+
+    OPENVINO_ASSERT(unregistered_variables.str().empty(),
+                    "Model references undeclared Variables: ",
+                    unregistered_variables.str());
+    bool only_pairs = std::all_of(pair_checker.begin(),
+                                  pair_checker.end(),
+                                  [](const std::pair<ov::op::util::Variable*, Counter>& val) {
+                                      return val.second.cnt_assign == 1 && val.second.cnt_read_val == 1;
+                                  });
+    OPENVINO_ASSERT(only_pairs,
+                    "Model is incorrect. Assign and ReadValue operations must be in pairs on the "
+                    "network.");
+    for (const auto& output : outputs) {
+        OPENVINO_ASSERT(ov::layout::utils::is_compatible(ov::layout::get_layout(output), output.get_partial_shape()),
+                        "Result '",
+                        output,
+                        "' with shape ",
+                        output.get_partial_shape(),
+                        " is incompatible with layout ",
+                        ov::layout::get_layout(output).to_string());
+    }
+}
+
 // Check that a Node argument for ctor isn't nullptr.
 const std::shared_ptr<ov::Node>& verify_node(const std::shared_ptr<ov::Node>& node) {
     OPENVINO_ASSERT(node != nullptr, "Model is incorrect! Some Node equals to nullptr.");
@@ -228,63 +285,43 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
 void ov::Model::validate_nodes_and_infer_types() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_nodes_and_infer_types");
 
-    struct Counter {
-        int cnt_assign = 0;
-        int cnt_read_val = 0;
-    };
-    std::map<ov::op::util::Variable*, Counter> pair_checker;
-    std::stringstream unregistered_parameters;
-    std::stringstream unregistered_variables;
-    std::unordered_set<const ov::descriptor::Tensor*> tensors;
-
-    for (auto& node : get_ordered_ops()) {
+    const auto ordered_ops = get_ordered_ops();
+    for (auto& node : ordered_ops)
         node->revalidate_and_infer_types();
-        for (const auto& output : node->outputs()) {
-            const auto& tensor = output.get_tensor();
-            // Skip results outputs tensors because result_input_tensor == result_output_tensor
-            if (tensors.count(&tensor))
-                continue;
-            tensors.insert(&tensor);
+    m_shared_rt_info->clear_changed_nodes();
+    check_validated_model(ordered_ops, m_parameters, m_variables, outputs());
+}
+
+size_t ov::Model::validate_changed_nodes_and_infer_types() const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_changed_nodes_and_infer_types");
+
+    const auto ordered_ops = get_ordered_ops();
+    // the nodes are in topological order, so the producers are checked before their consumers
+    std::unordered_set<const Node*> changed;
+    for (const auto& node : ordered_ops) {
+        bool is_changed = m_shared_rt_info->is_changed(node.get());
+        for (size_t i = 0; !is_changed && i < node->get_input_size(); ++i)
+            is_changed = changed.count(node->get_input_node_ptr(i)) != 0;
+        if (!is_changed) {
+            if (const auto& multi_subgraph_op = dynamic_pointer_cast<op::util::MultiSubGraphOp>(node)) {
+                for (size_t i = 0; i < multi_subgraph_op->get_internal_subgraphs_size(); ++i) {
+                    const auto& body = multi_subgraph_op->get_function(i);
+                    if (body && (body->m_shared_rt_info->has_changed_nodes() ||
+                                 !body->m_shared_rt_info->get_use_topological_cache())) {
+                        is_changed = true;
+                        break;
+                    }
+                }
+            }
         }
-        if (op::util::is_parameter(node) &&
-            std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
-            unregistered_parameters << node << std::endl;
-
-        const auto& variable_op = dynamic_pointer_cast<op::util::VariableExtension>(node);
-        if (variable_op &&
-            std::find(m_variables.begin(), m_variables.end(), variable_op->get_variable()) == m_variables.end())
-            unregistered_variables << variable_op->get_variable_id() << std::endl;
-
-        if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(node)) {
-            pair_checker[assign->get_variable().get()].cnt_assign++;
-        } else if (const auto& read_value = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(node)) {
-            pair_checker[read_value->get_variable().get()].cnt_read_val++;
+        if (is_changed) {
+            node->revalidate_and_infer_types();
+            changed.insert(node.get());
         }
     }
-
-    OPENVINO_ASSERT(unregistered_parameters.str().empty(),
-                    "Model references undeclared parameters: ",
-                    unregistered_parameters.str());
-
-    OPENVINO_ASSERT(unregistered_variables.str().empty(),
-                    "Model references undeclared Variables: ",
-                    unregistered_variables.str());
-    bool only_pairs =
-        std::all_of(pair_checker.begin(), pair_checker.end(), [](const std::pair<op::util::Variable*, Counter>& val) {
-            return val.second.cnt_assign == 1 && val.second.cnt_read_val == 1;
-        });
-    OPENVINO_ASSERT(only_pairs,
-                    "Model is incorrect. Assign and ReadValue operations must be in pairs on the "
-                    "network.");
-    for (const auto& output : outputs()) {
-        OPENVINO_ASSERT(ov::layout::utils::is_compatible(ov::layout::get_layout(output), output.get_partial_shape()),
-                        "Result '",
-                        output,
-                        "' with shape ",
-                        output.get_partial_shape(),
-                        " is incompatible with layout ",
-                        ov::layout::get_layout(output).to_string());
-    }
+    m_shared_rt_info->clear_changed_nodes();
+    check_validated_model(ordered_ops, m_parameters, m_variables, outputs());
+    return changed.size();
 }
 
 std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
@@ -319,7 +356,9 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
         m_cached_ops.insert(node.get());
-        node->insert_info(m_shared_rt_info);
+        // the nodes which are new in the model haven't been validated as a part of it
+        if (node->insert_info(m_shared_rt_info))
+            m_shared_rt_info->mark_as_changed(node.get());
     });
     m_cached_output_names.clear();
     m_cached_op_names.clear();
@@ -522,58 +561,24 @@ bool ov::Model::evaluate(ov::TensorVector& output_tensors, const ov::TensorVecto
 bool ov::Model::evaluate(ov::TensorVector& output_tensors,
                          const ov::TensorVector& input_tensors,
                          ov::EvaluationContext& evaluation_context) const {
-    evaluation_context.emplace("VariableContext", ov::op::util::VariableContext());
-    std::map<RawNodeOutput, ov::Tensor> value_map;
-    for (size_t i = 0; i < m_parameters.size(); ++i) {
-        value_map[m_parameters.at(i)->output(0)] = input_tensors.at(i);
-    }
-    OutputVector outputs;
-    std::map<RawNodeOutput, ov::Tensor> output_tensor_map;
-    for (size_t i = 0; i < m_results.size(); ++i) {
-        auto result = m_results.at(i)->output(0);
-        output_tensor_map[result] = output_tensors.at(i);
-        outputs.push_back(result);
-    }
-    for (const auto& m_sink : m_sinks) {
-        outputs.push_back(m_sink);
+    std::unique_lock<std::mutex> lock(m_evaluator_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        // the kept evaluator is used by another thread
+        ModelEvaluator evaluator(*this);
+        return evaluator.evaluate(output_tensors, input_tensors, evaluation_context);
     }
-    // evaluate nodes
-    OPENVINO_SUPPRESS_DEPRECATED_START
-    ngraph::Evaluator<ov::Tensor> evaluator({}, value_map);
-    evaluator.set_universal_handler(
-        [&output_tensor_map, &evaluation_context](Node* node,
-                                                  const ov::TensorVector& input_tensors) -> ov::TensorVector {
-            ov::TensorVector output_tensors;
-            for (const auto& v : node->outputs()) {
-                auto it = output_tensor_map.find(v);
-                if (it == output_tensor_map.end()) {
-                    output_tensors.push_back(util::wrap_tensor(v));
-                } else {
-                    output_tensors.push_back(it->second);
-                }
-            }
-            if (node->evaluate(output_tensors, input_tensors, evaluation_context)) {
-                for (size_t i = 0; i < node->outputs().size(); i++) {
-                    const auto& v = node->output(i);
-                    auto it = output_tensor_map.find(v);
-                    if (it != output_tensor_map.end()) {
-                        it->second = output_tensors[i];
-                    }
-                }
-                return output_tensors;
-            } else {
-                OPENVINO_ASSERT(false, "Evaluation failed on ", node);
-            }
-        });
-    for (const auto& value : outputs) {
-        evaluator.evaluate(value);
-    }
-    OPENVINO_SUPPRESS_DEPRECATED_END
-    for (size_t i = 0; i < m_results.size(); ++i) {
-        auto result = m_results.at(i)->output(0);
-        output_tensors.at(i) = output_tensor_map[result];
+
+    // the version is taken before the evaluator is built, so the changes made meanwhile cause a rebuild
+    const auto topology_version = m_shared_rt_info->get_topology_version();
+    if (!m_evaluator || m_evaluator_topology_version != topology_version || !m_evaluator->is_up_to_date()) {
+        m_evaluator.reset();
+        m_evaluator = std::make_shared<ModelEvaluator>(*this);
+        // the nodes removed from the model must not be kept alive as consumers of their inputs,
+        // the evaluator isn't used after the topology changes
+        m_evaluator->release_nodes();
+        m_evaluator_topology_version = topology_version;
     }
-    return true;
+    return m_evaluator->evaluate(output_tensors, input_tensors, evaluation_context);
 }
 
 bool ov::Model::visit_attributes(AttributeVisitor& visitor) {
@@ -0,0 +1,231 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/model_evaluator.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+
+#include "itt.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/variable_context.hpp"
+#include "tensor_conversion_util.hpp"
+
+namespace {
+
+size_t get_byte_size(const ov::Output<ov::Node>& output) {
+    const auto& et = output.get_element_type();
+    return (ov::shape_size(output.get_shape()) * et.bitwidth() + 7) >> 3;
+}
+
+}  // namespace
+
+ov::ModelEvaluator::ModelEvaluator(const Model& model) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ModelEvaluator::ModelEvaluator");
+
+    m_nodes = model.get_ordered_ops();
+    const auto& ordered_ops = m_nodes;
+
+    // every node output gets a slot, the slots of a node are contiguous
+    std::unordered_map<const Node*, size_t> first_slots;
+    std::vector<Output<Node>> slot_outputs;
+    for (const auto& node : ordered_ops) {
+        first_slots[node.get()] = slot_outputs.size();
+        for (const auto& output : node->outputs())
+            slot_outputs.push_back(output);
+    }
+    const auto get_slot = [&first_slots](const Output<Node>& output) {
+        return first_slots.at(output.get_node()) + output.get_index();
+    };
+
+    m_planned_values.resize(slot_outputs.size());
+    for (const auto& node : ordered_ops) {
+        if (const auto constant = ov::as_type_ptr<op::v0::Constant>(node)) {
+            // constants are used in place, so they are not copied by every evaluation
+            auto& value = m_planned_values[get_slot(constant->output(0))];
+            if (constant->get_byte_size() == 0)
+                value = Tensor(constant->get_element_type(), constant->get_shape());
+            else
+                value = Tensor(constant->get_element_type(),
+                               constant->get_shape(),
+                               const_cast<void*>(constant->get_data_ptr()));
+            continue;
+        }
+        if (op::util::is_parameter(node))
+            continue;
+
+        Step step;
+        step.node = node.get();
+        for (const auto& input : node->input_values())
+            step.inputs.push_back(get_slot(input));
+        for (const auto& output : node->outputs()) {
+            step.outputs.push_back(get_slot(output));
+            step.output_types.push_back(output.get_element_type());
+            step.output_shapes.push_back(output.get_partial_shape());
+        }
+        m_steps.push_back(std::move(step));
+    }
+
+    for (const auto& parameter : model.get_parameters())
+        m_parameter_slots.push_back(get_slot(parameter->output(0)));
+    for (const auto& result : model.get_results())
+        m_result_slots.push_back(get_slot(result->output(0)));
+
+    // liveness: the value is released after the last step which uses it or right after the step which
+    // produces it if nothing uses it
+    std::vector<size_t> last_use(slot_outputs.size(), 0);
+    for (size_t s = 0; s < m_steps.size(); ++s) {
+        for (const auto slot : m_steps[s].outputs)
+            last_use[slot] = s;
+        for (const auto slot : m_steps[s].inputs)
+            last_use[slot] = s;
+    }
+
+    // greedy buffers assignment for the values of static shapes in the evaluation order:
+    // the buffers of the released values are reused by the values produced later
+    std::vector<size_t> buffer_sizes;
+    std::vector<size_t> slot_buffers(slot_outputs.size(), SIZE_MAX);
+    std::multimap<size_t, size_t> free_buffers;
+    for (size_t s = 0; s < m_steps.size(); ++s) {
+        auto& step = m_steps[s];
+        const bool is_result = op::util::is_output(step.node);
+        for (const auto slot : step.outputs) {
+            const auto& output = slot_outputs[slot];
+            if (is_result || output.get_element_type().is_dynamic() || output.get_partial_shape().is_dynamic())
+                continue;
+            const auto byte_size = get_byte_size(output);
+            if (byte_size == 0)
+                continue;
+
+            size_t buffer = 0;
+            auto it = free_buffers.lower_bound(byte_size);
+            if (it == free_buffers.end() && !free_buffers.empty()) {
+                // grow the largest free buffer instead of allocating one more
+                it = std::prev(free_buffers.end());
+            }
+            if (it != free_buffers.end()) {
+                buffer = it->second;
+                free_buffers.erase(it);
+                buffer_sizes[buffer] = std::max(buffer_sizes[buffer], byte_size);
+            } else {
+                buffer = buffer_sizes.size();
+                buffer_sizes.push_back(byte_size);
+            }
+            slot_buffers[slot] = buffer;
+        }
+
+        // the outputs are assigned before the inputs are released, so the node never writes to its inputs,
+        // the outputs of the results are returned to the caller
+        const auto release = [&](size_t slot) {
+            const auto& released = step.released;
+            if (last_use[slot] != s || std::find(released.begin(), released.end(), slot) != released.end())
+                return;
+            step.released.push_back(slot);
+            if (slot_buffers[slot] != SIZE_MAX)
+                free_buffers.emplace(buffer_sizes[slot_buffers[slot]], slot_buffers[slot]);
+        };
+        for (const auto slot : step.inputs)
+            release(slot);
+        if (!is_result) {
+            for (const auto slot : step.outputs)
+                release(slot);
+        }
+    }
+
+    for (const auto size : buffer_sizes)
+        m_buffers.emplace_back(element::u8, Shape{size});
+    for (size_t slot = 0; slot < slot_outputs.size(); ++slot) {
+        if (slot_buffers[slot] == SIZE_MAX)
+            continue;
+        const auto& output = slot_outputs[slot];
+        m_planned_values[slot] =
+            Tensor(output.get_element_type(), output.get_shape(), m_buffers[slot_buffers[slot]].data());
+    }
+}
+
+bool ov::ModelEvaluator::evaluate(TensorVector& output_tensors, const TensorVector& input_tensors) {
+    EvaluationContext evaluation_context;
+    return evaluate(output_tensors, input_tensors, evaluation_context);
+}
+
+bool ov::ModelEvaluator::evaluate(TensorVector& output_tensors,
+                                  const TensorVector& input_tensors,
+                                  EvaluationContext& evaluation_context) {
+    OPENVINO_ASSERT(input_tensors.size() >= m_parameter_slots.size(),
+                    "Expected ",
+                    m_parameter_slots.size(),
+                    " input tensors, got ",
+                    input_tensors.size());
+    OPENVINO_ASSERT(output_tensors.size() >= m_result_slots.size(),
+                    "Expected ",
+                    m_result_slots.size(),
+                    " output tensors, got ",
+                    output_tensors.size());
+
+    evaluation_context.emplace("VariableContext", ov::op::util::VariableContext());
+    m_values = m_planned_values;
+    for (size_t i = 0; i < m_parameter_slots.size(); ++i)
+        m_values[m_parameter_slots[i]] = input_tensors[i];
+    for (size_t i = 0; i < m_result_slots.size(); ++i)
+        m_values[m_result_slots[i]] = output_tensors[i];
+
+    for (const auto& step : m_steps) {
+        const auto node = step.node;
+        const bool is_result = op::util::is_output(node);
+        m_step_inputs.clear();
+        for (const auto slot : step.inputs)
+            m_step_inputs.push_back(m_values[slot]);
+        m_step_outputs.clear();
+        for (size_t i = 0; i < step.outputs.size(); ++i) {
+            const auto& value = m_values[step.outputs[i]];
+            m_step_outputs.push_back(value || is_result ? value : util::wrap_tensor(node->output(i)));
+        }
+
+        OPENVINO_ASSERT(node->evaluate(m_step_outputs, m_step_inputs, evaluation_context),
+                        "Evaluation failed on ",
+                        node);
+
+        for (size_t i = 0; i < step.outputs.size(); ++i)
+            m_values[step.outputs[i]] = m_step_outputs[i];
+        // the tensors allocated by the nodes are freed as soon as they are not needed
+        for (const auto slot : step.released) {
+            if (!m_planned_values[slot])
+                m_values[slot] = {};
+        }
+    }
+
+    for (size_t i = 0; i < m_result_slots.size(); ++i)
+        output_tensors[i] = m_values[m_result_slots[i]];
+
+    // the evaluator doesn't hold the tensors of the caller between evaluations
+    m_values.clear();
+    m_step_inputs.clear();
+    m_step_outputs.clear();
+    return true;
+}
+
+bool ov::ModelEvaluator::is_up_to_date() const {
+    for (const auto& step : m_steps) {
+        for (size_t i = 0; i < step.outputs.size(); ++i) {
+            if (step.node->get_output_element_type(i) != step.output_types[i] ||
+                step.node->get_output_partial_shape(i) != step.output_shapes[i])
+                return false;
+        }
+    }
+    return true;
+}
+
+void ov::ModelEvaluator::release_nodes() {
+    m_nodes.clear();
+}
+
+size_t ov::ModelEvaluator::get_buffers_byte_size() const {
+    size_t byte_size = 0;
+    for (const auto& buffer : m_buffers)
+        byte_size += buffer.get_byte_size();
+    return byte_size;
+}
@@ -87,9 +87,9 @@ ov::Node& ov::Node::operator=(const Node& node) {
     return *this;
 }
 
-void ov::Node::insert_info(std::shared_ptr<SharedRTInfo> info) {
+bool ov::Node::insert_info(std::shared_ptr<SharedRTInfo> info) {
     std::lock_guard<std::mutex> lock(m_insert_mutex);
-    m_shared_rt_info.insert(std::move(info));
+    return m_shared_rt_info.insert(std::move(info)).second;
 }
 
 ov::Node::Node(size_t output_size) : Node() {
@@ -239,6 +239,11 @@ void ov::Node::set_argument(size_t position, const Output<Node>& argument) {
             m_inputs.emplace_back(this, m_inputs.size());
         }
         m_inputs.emplace_back(this, position, output_descriptor);
+
+        // the new input doesn't use replace_output method, so we have to mark the node as changed here
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [this](const std::shared_ptr<SharedRTInfo>& info) {
+            info->mark_as_changed(this);
+        });
     }
 }
 
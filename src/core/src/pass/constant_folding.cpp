@@ -5,10 +5,19 @@
 #include "openvino/pass/constant_folding.hpp"
 
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_map>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
@@ -51,48 +60,123 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Groups the nodes by levels, the inputs of a node belong to the previous levels.
+ *
+ * The nodes of a level don't depend on each other and the levels keep the topological order.
+ *
+ * \param ordered_ops  Nodes in the topological order.
+ *
+ * \return Vector of levels.
+ */
+const auto get_levels = [](const std::vector<std::shared_ptr<ov::Node>>& ordered_ops) {
+    std::unordered_map<const ov::Node*, size_t> node_levels;
+    std::vector<std::vector<std::shared_ptr<ov::Node>>> levels;
+    for (const auto& node : ordered_ops) {
+        size_t level = 0;
+        for (const auto& input : node->input_values())
+            level = std::max(level, node_levels.at(input.get_node()) + 1);
+        for (const auto& dependency : node->get_control_dependencies())
+            level = std::max(level, node_levels.at(dependency.get()) + 1);
+        node_levels[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+    return levels;
+};
+
+/**
+ * \brief Check if the node can be folded concurrently with the other nodes.
+ *
+ * The evaluation of the operations with a lot of data is independent of the other nodes and doesn't modify the
+ * graph. The other operations are folded one by one, as their folding may evaluate and cache the bounds of the
+ * shared inputs.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if the node has constant inputs only and its folding doesn't touch the other nodes.
+ */
+const auto is_concurrently_foldable = [](const ov::Node& node) {
+    if (!ov::is_type<ov::op::v0::Convert>(&node) && !ov::is_type<ov::op::v1::Add>(&node) &&
+        !ov::is_type<ov::op::v1::Subtract>(&node) && !ov::is_type<ov::op::v1::Multiply>(&node) &&
+        !ov::is_type<ov::op::v1::Divide>(&node) && !ov::is_type<ov::op::v1::Transpose>(&node) &&
+        !ov::is_type<ov::op::v0::Concat>(&node))
+        return false;
+    const auto& input_values = node.input_values();
+    return std::all_of(input_values.begin(), input_values.end(), [](const ov::Output<ov::Node>& input) {
+        return ov::is_type<ov::op::v0::Constant>(input.get_node());
+    });
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    for (const auto& level : get_levels(model->get_ordered_ops())) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            for (const auto& node : level)
+                node->validate_and_infer_types();
         }
 
-        OutputVector replacements(node->get_output_size());
-
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
+        // the nodes of the level are folded first, the graph is modified after all of them are folded
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<char> folded(level.size(), false);
+        std::vector<size_t> concurrent;
+        for (size_t i = 0; i < level.size(); ++i) {
+            const auto& node = level[i];
+            replacements[i].resize(node->get_output_size());
+            if (is_concurrently_foldable(*node))
+                concurrent.push_back(i);
+            else
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+        }
+        ngraph::runtime::reference::parallel_for_chunks(
+            concurrent.size(),
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const auto& node = level[concurrent[i]];
+                    folded[concurrent[i]] = node->constant_fold(replacements[concurrent[i]], node->input_values());
+                }
+            },
+            1);
 
-                    rewritten = true;
+        for (size_t n = 0; n < level.size(); ++n) {
+            const auto& node = level[n];
+            if (folded[n]) {
+                const auto& node_replacements = replacements[n];
+                OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                                "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                                node);
+                OPENVINO_ASSERT(node_replacements.size() == node->get_output_size(),
+                                "constant_fold_default returned incorrect number of replacements for ",
+                                node);
+
+                for (size_t i = 0; i < node_replacements.size(); ++i) {
+                    auto node_output = node->output(i);
+                    auto replacement = node_replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                        replacement.get_node()->set_friendly_name(
+                            friendly_name_from(*node, node_replacements.size(), i));
+
+                        node_output.replace(replacement);
+                        // Copy runtime info from source nodes
+                        // when it was not propogated during pre-calculation
+                        copy_runtime_info_from_input_values(node);
+                        // Propagate runtime info attributes to replacement
+                        copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+                        rewritten = true;
+                    }
                 }
-            }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+            } else {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+                    }
                 }
             }
         }
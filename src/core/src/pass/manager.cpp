@@ -26,28 +26,38 @@
 
 using namespace std;
 
-#ifdef ENABLE_PROFILING_ITT
+namespace {
+bool getenv_visualize_tracing() {
+    return ov::util::getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING") ||
+           ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING");
+}
+
+bool getenv_profile_pass() {
+    return ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+}
+}  // namespace
 
 namespace ov {
 namespace pass {
 namespace {
+class ProfiledPerfCounters : public PerfCounters {
+public:
+    ~ProfiledPerfCounters() {
+        if (getenv_profile_pass()) {
+            cout << "passes statistics:\n";
+            print_statistics(cout);
+        }
+    }
+};
+}  // namespace
+
 PerfCounters& perf_counters() {
-    static PerfCounters counters;
+    static ProfiledPerfCounters counters;
     return counters;
 }
-}  // namespace
 }  // namespace pass
 }  // namespace ov
 
-#endif  // ENABLE_PROFILING_ITT
-
-namespace {
-bool getenv_visualize_tracing() {
-    return ov::util::getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING") ||
-           ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING");
-}
-}  // namespace
-
 ov::pass::Manager::Manager() : m_pass_config(std::make_shared<PassConfig>()), m_visualize(getenv_visualize_tracing()) {}
 
 ov::pass::Manager::~Manager() = default;
@@ -64,8 +74,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::Manager::run_passes");
 
-    static bool profile_enabled =
-        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    static bool profile_enabled = getenv_profile_pass();
 
     size_t index = 0;
     ngraph::stopwatch pass_timer;
@@ -74,6 +83,12 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     bool pass_applied = false;
     bool function_changed = false;
     bool needs_validate = false;
+    // the pass whose changes are validated by the next Validate pass
+    const DiscreteTypeInfo* changed_by = nullptr;
+    size_t validated_nodes = 0;
+    size_t total_validated_nodes = 0;
+    // the incremental validations do not see the attributes changed in place, so they are followed by a full one
+    bool needs_full_validate = false;
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             OPENVINO_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -83,6 +98,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
+        validated_nodes = 0;
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
@@ -106,7 +122,18 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (needs_validate) {
-                    function_pass->run_on_model(func);
+                    // only the nodes changed since the previous validation and their consumers are revalidated,
+                    // the last validation is a full one as the attributes changed in place are not tracked
+                    if (pass == m_pass_list.back()) {
+                        function_pass->run_on_model(func);
+                        validated_nodes = func->get_ordered_ops().size();
+                        needs_full_validate = false;
+                    } else {
+                        validated_nodes = func->validate_changed_nodes_and_infer_types();
+                        needs_full_validate = true;
+                    }
+                    perf_counters().add_validation(*changed_by, validated_nodes);
+                    total_validated_nodes += validated_nodes;
                     needs_validate = false;
                 }
             } else {
@@ -138,14 +165,34 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
         index++;
         pass_timer.stop();
+        perf_counters().add_run(pass->get_type_info(), pass_timer.get_microseconds());
         if (profile_enabled) {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name();
+            if (validated_nodes)
+                cout << " (" << validated_nodes << " nodes validated)";
+            cout << "\n";
         }
         function_changed = function_changed || pass_applied;
         needs_validate = pass_applied;
+        if (pass_applied && !dynamic_pointer_cast<Validate>(pass))
+            changed_by = &pass->get_type_info();
+    }
+    // the last Validate is skipped when the pass before it changed nothing
+    if (needs_full_validate) {
+        pass_timer.start();
+        func->validate_nodes_and_infer_types();
+        validated_nodes = func->get_ordered_ops().size();
+        pass_timer.stop();
+        perf_counters().add_validation(*changed_by, validated_nodes);
+        total_validated_nodes += validated_nodes;
+        if (profile_enabled) {
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms final validation (" << validated_nodes
+                 << " nodes validated)\n";
+        }
     }
     if (profile_enabled) {
-        cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        cout << "passes done in " << overall_timer.get_milliseconds() << "ms, " << total_validated_nodes
+             << " nodes validated\n";
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
 
@@ -3,6 +3,10 @@
 //
 #include "perf_counters.hpp"
 
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
 namespace ov {
 namespace pass {
 openvino::itt::handle_t PerfCounters::operator[](::ngraph::Node::type_info_t const& type_inf) {
@@ -12,5 +16,41 @@ openvino::itt::handle_t PerfCounters::operator[](::ngraph::Node::type_info_t con
         return it->second;
     return m_counters[&type_inf] = openvino::itt::handle(type_inf.name);
 }
+
+void PerfCounters::add_run(::ngraph::Node::type_info_t const& type_inf, size_t time_us) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto& statistics = m_statistics[&type_inf];
+    statistics.runs++;
+    statistics.time_us += time_us;
+}
+
+void PerfCounters::add_validation(::ngraph::Node::type_info_t const& type_inf, size_t validated_nodes) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto& statistics = m_statistics[&type_inf];
+    statistics.validations++;
+    statistics.validated_nodes += validated_nodes;
+}
+
+PerfCounters::PassStatistics PerfCounters::get_statistics(::ngraph::Node::type_info_t const& type_inf) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_statistics.find(&type_inf);
+    return it != m_statistics.end() ? it->second : PassStatistics{};
+}
+
+void PerfCounters::print_statistics(std::ostream& out) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    std::vector<std::pair<key, PassStatistics>> statistics(m_statistics.begin(), m_statistics.end());
+    std::sort(statistics.begin(),
+              statistics.end(),
+              [](const std::pair<key, PassStatistics>& a, const std::pair<key, PassStatistics>& b) {
+                  return a.second.time_us > b.second.time_us;
+              });
+    for (const auto& item : statistics) {
+        const auto& s = item.second;
+        out << std::setw(10) << s.time_us / 1000.0 << "ms " << std::setw(6) << s.runs << " runs " << std::setw(6)
+            << s.validations << " validations " << std::setw(9) << s.validated_nodes << " validated nodes "
+            << item.first->name << "\n";
+    }
+}
 }  // namespace pass
 }  // namespace ov
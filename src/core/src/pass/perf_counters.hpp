@@ -5,19 +5,38 @@
 #include <itt.hpp>
 #include <mutex>
 #include <ngraph/node.hpp>
+#include <ostream>
 #include <unordered_map>
 
+#include "openvino/core/core_visibility.hpp"
+
 namespace ov {
 namespace pass {
-class PerfCounters {
+class OPENVINO_API PerfCounters {
     PerfCounters(PerfCounters const&) = delete;
     PerfCounters& operator=(PerfCounters const&) = delete;
 
 public:
+    /// \brief Accumulated statistics of a pass over all pass::Manager runs.
+    struct PassStatistics {
+        size_t runs = 0;
+        size_t time_us = 0;
+        // validations of the changes made by the pass and the number of the nodes they validated
+        size_t validations = 0;
+        size_t validated_nodes = 0;
+    };
+
     PerfCounters() = default;
 
     openvino::itt::handle_t operator[](::ngraph::Node::type_info_t const& type_inf);
 
+    void add_run(::ngraph::Node::type_info_t const& type_inf, size_t time_us);
+    void add_validation(::ngraph::Node::type_info_t const& type_inf, size_t validated_nodes);
+    PassStatistics get_statistics(::ngraph::Node::type_info_t const& type_inf);
+
+    /// \brief Prints the statistics of the passes in the descending order of their time.
+    void print_statistics(std::ostream& out);
+
 private:
     using key = ::ngraph::Node::type_info_t const*;
     using value = openvino::itt::handle_t;
@@ -25,6 +44,10 @@ private:
 
     std::mutex m_mutex;
     counters_map m_counters;
+    std::unordered_map<key, PassStatistics> m_statistics;
 };
+
+/// \brief Returns the counters collected by all pass::Manager runs.
+OPENVINO_API PerfCounters& perf_counters();
 }  // namespace pass
 }  // namespace ov
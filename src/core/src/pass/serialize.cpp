@@ -4,6 +4,7 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
@@ -12,8 +13,10 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "itt.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/coordinate_diff.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
@@ -63,63 +66,200 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+constexpr size_t bin_file_buffer_size = 4 << 20;
+
+// 128-bit MurmurHash3 (x64 variant) of the buffer.
+struct HashValue {
+    uint64_t low;
+    uint64_t high;
+
+    bool operator==(const HashValue& other) const {
+        return low == other.low && high == other.high;
+    }
+};
+
+struct HashValueHasher {
+    size_t operator()(const HashValue& value) const {
+        return static_cast<size_t>(value.low);
+    }
+};
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+HashValue murmur3_128(const char* data, size_t size, uint64_t seed) {
+    constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+    constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+    const auto mix_k1 = [](uint64_t k1) {
+        return rotl64(k1 * c1, 31) * c2;
+    };
+    const auto mix_k2 = [](uint64_t k2) {
+        return rotl64(k2 * c2, 33) * c1;
+    };
+
+    uint64_t h1 = seed;
+    uint64_t h2 = seed;
+    const size_t blocks = size / 16;
+    for (size_t i = 0; i < blocks; ++i) {
+        uint64_t k[2];
+        std::memcpy(k, data + i * 16, 16);
+        h1 ^= mix_k1(k[0]);
+        h1 = (rotl64(h1, 27) + h2) * 5 + 0x52dce729;
+        h2 ^= mix_k2(k[1]);
+        h2 = (rotl64(h2, 31) + h1) * 5 + 0x38495ab5;
+    }
+
+    // the tail is read as little endian words, as the reference implementation does on x86 and ARM
+    const size_t tail_size = size % 16;
+    uint64_t k[2] = {0, 0};
+    std::memcpy(k, data + blocks * 16, tail_size);
+    if (tail_size > 8)
+        h2 ^= mix_k2(k[1]);
+    if (tail_size > 0)
+        h1 ^= mix_k1(k[0]);
+
+    h1 ^= size;
+    h2 ^= size;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+    return {h1, h2};
+}
+
+// The large buffers are hashed by blocks, which are hashed in parallel, and the hash of the buffer
+// is the hash of the blocks hashes.
+constexpr size_t hash_block_size = 1 << 20;
+
+size_t get_hash_blocks_count(size_t size) {
+    return std::max<size_t>((size + hash_block_size - 1) / hash_block_size, 1);
+}
+
+HashValue hash_block(const char* data, size_t size, size_t block) {
+    const size_t offset = block * hash_block_size;
+    return murmur3_128(data + offset, std::min(hash_block_size, size - offset), 0);
+}
+
+HashValue combine_block_hashes(const HashValue* block_hashes, size_t blocks, size_t size) {
+    if (blocks == 1)
+        return block_hashes[0];
+    return murmur3_128(reinterpret_cast<const char*>(block_hashes), blocks * sizeof(HashValue), size);
+}
+
+HashValue hash_buffer(const char* data, size_t size) {
+    std::vector<HashValue> block_hashes(get_hash_blocks_count(size));
+    for (size_t block = 0; block < block_hashes.size(); ++block)
+        block_hashes[block] = hash_block(data, size, block);
+    return combine_block_hashes(block_hashes.data(), block_hashes.size(), size);
+}
+
+void collect_constants(const ov::Model& model, std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& node : model.get_ordered_ops()) {
+        if (const auto& constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+            constants.push_back(constant);
+        } else if (const auto& multi_subgraph_op = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < multi_subgraph_op->get_internal_subgraphs_size(); ++i) {
+                if (const auto& body = multi_subgraph_op->get_function(i))
+                    collect_constants(*body, constants);
+            }
+        }
+    }
 }
 
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
-    using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
+    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>, HashValueHasher>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data),
-          m_enable_compression(enable_compression),
-          m_blob_offset(bin_data.tellp()) {}
+          m_enable_compression(enable_compression) {}
+
+    // Hashes the data of the model constants in parallel before they are written one by one.
+    void precompute_hashes(const ov::Model& model) {
+        if (!m_enable_compression)
+            return;
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ConstantWriter::precompute_hashes");
+
+        std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+        collect_constants(model, constants);
+        std::vector<std::pair<const char*, size_t>> buffers;
+        std::vector<size_t> first_blocks;
+        size_t blocks = 0;
+        for (const auto& constant : constants) {
+            const auto data = static_cast<const char*>(constant->get_data_ptr());
+            if (!data || m_precomputed_hashes.count(data))
+                continue;
+            m_precomputed_hashes[data] = {};
+            buffers.emplace_back(data, constant->get_byte_size());
+            first_blocks.push_back(blocks);
+            blocks += get_hash_blocks_count(buffers.back().second);
+        }
+        first_blocks.push_back(blocks);
+
+        std::vector<HashValue> block_hashes(blocks);
+        ngraph::runtime::reference::parallel_for_chunks(
+            blocks,
+            [&](size_t begin, size_t end) {
+                size_t buffer =
+                    std::upper_bound(first_blocks.begin(), first_blocks.end(), begin) - first_blocks.begin() - 1;
+                for (size_t block = begin; block < end; ++block) {
+                    while (block >= first_blocks[buffer + 1])
+                        ++buffer;
+                    block_hashes[block] =
+                        hash_block(buffers[buffer].first, buffers[buffer].second, block - first_blocks[buffer]);
+                }
+            },
+            1);
+
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            const auto hash = combine_block_hashes(&block_hashes[first_blocks[i]],
+                                                   first_blocks[i + 1] - first_blocks[i],
+                                                   buffers[i].second);
+            m_precomputed_hashes[buffers[i].first] = {buffers[i].second, hash};
+        }
+    }
 
     FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
-        if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
-            return offset;
-        }
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
-        const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        const auto offset = m_write_offset;
+        if (m_enable_compression) {
+            const auto precomputed = m_precomputed_hashes.find(ptr);
+            const HashValue hash = precomputed != m_precomputed_hashes.end() && precomputed->second.first == size
+                                       ? precomputed->second.second
+                                       : hash_buffer(ptr, size);
+            // the data is compared anyway, as the hash is not a cryptographic one
+            const auto found = m_hash_to_file_positions.find(hash);
+            if (found != end(m_hash_to_file_positions) &&
+                memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
+                return found->second.first;
+            }
+            m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
         }
 
+        // the position is tracked here, as tellp() of a file stream costs a system call
         m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
-
+        m_write_offset += static_cast<FilePosition>(size);
         return offset;
     }
 
 private:
     ConstWritePositions m_hash_to_file_positions;
+    std::unordered_map<const char*, std::pair<size_t, HashValue>> m_precomputed_hashes;
     std::ostream& m_binary_output;
     bool m_enable_compression;
-    FilePosition m_blob_offset;  // blob offset inside output stream
+    FilePosition m_write_offset = 0;  // write offset relative to the blob beginning in the output stream
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -1073,6 +1213,7 @@ void serializeFunc(std::ostream& xml_file,
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
     ConstantWriter constant_write_handler(bin_file);
+    constant_write_handler.precompute_hashes(*model);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
@@ -1093,7 +1234,11 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         if (xmlDir != m_xmlPath)
             ov::util::create_directory_recursive(xmlDir);
 
-        std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
+        // the small constants are collected in a large buffer, the large ones are written directly
+        std::vector<char> bin_buffer(bin_file_buffer_size);
+        std::ofstream bin_file;
+        bin_file.rdbuf()->pubsetbuf(bin_buffer.data(), bin_buffer.size());
+        bin_file.open(m_binPath, std::ios::out | std::ios::binary);
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
@@ -1212,6 +1357,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
     ConstantWriter constant_write_handler(m_stream);
+    constant_write_handler.precompute_hashes(*model);
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = model;
     visitor.on_attribute(name, fun);
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <unordered_set>
 
 namespace ov {
 class SharedRTInfo {
@@ -15,13 +18,49 @@ public:
 
     void set_use_topological_cache(bool status) {
         m_use_topological_cache = status;
+        if (!status)
+            ++m_topology_version;
     }
 
     bool get_use_topological_cache() const {
         return m_use_topological_cache;
     }
 
+    /// \brief Returns the number of the topological cache resets, so the data built for a topology of the model
+    /// can be checked to be up to date even after the topological cache is rebuilt.
+    size_t get_topology_version() const {
+        return m_topology_version;
+    }
+
+    /// \brief Marks the node as changed since the last validation of the model: its inputs were replaced or
+    /// it was added to the model.
+    ///
+    /// The node is not owned, so a pointer may outlive the node. It is used for lookups of the alive nodes only,
+    /// a new node at the same address is validated as a changed one, which is safe.
+    void mark_as_changed(const Node* node) {
+        std::lock_guard<std::mutex> lock(m_changed_nodes_mutex);
+        m_changed_nodes.insert(node);
+    }
+
+    bool is_changed(const Node* node) const {
+        std::lock_guard<std::mutex> lock(m_changed_nodes_mutex);
+        return m_changed_nodes.count(node) != 0;
+    }
+
+    bool has_changed_nodes() const {
+        std::lock_guard<std::mutex> lock(m_changed_nodes_mutex);
+        return !m_changed_nodes.empty();
+    }
+
+    void clear_changed_nodes() {
+        std::lock_guard<std::mutex> lock(m_changed_nodes_mutex);
+        m_changed_nodes.clear();
+    }
+
 private:
     bool m_use_topological_cache;
+    std::atomic<size_t> m_topology_version{0};
+    std::unordered_set<const Node*> m_changed_nodes;
+    mutable std::mutex m_changed_nodes_mutex;
 };
 }  // namespace ov
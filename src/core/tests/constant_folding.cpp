@@ -4,6 +4,8 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <chrono>
+#include <numeric>
 #include <transformations/utils/utils.hpp>
 
 #include "common_test_utils/all_close_f.hpp"
@@ -3911,3 +3913,227 @@ TEST(constant_folding, gather_with_dynamic_shapes_in_data_input) {
     check_names(strided_slice, {"strided_slice"}, "strided_slice");
     check_names(res, {"result"}, "result");
 }
+
+namespace {
+// Convert(u8) -> Subtract(zero point) -> Multiply(scale), the usual decompression of the compressed weights.
+// The zero point is per row and the scale is per column, so both operands of the numpy broadcasting are sliced.
+// The decompressed values are computed sequentially into expected.
+std::shared_ptr<ov::Node> make_decompression(const ov::Shape& shape,
+                                             size_t seed,
+                                             const std::string& name,
+                                             std::vector<float>& expected) {
+    const size_t rows = shape[0], cols = shape[1];
+    std::vector<uint8_t> weights_values(rows * cols);
+    for (size_t i = 0; i < weights_values.size(); ++i)
+        weights_values[i] = static_cast<uint8_t>((i + seed) % 251);
+    std::vector<float> zero_point_values(rows), scale_values(cols);
+    for (size_t row = 0; row < rows; ++row)
+        zero_point_values[row] = static_cast<float>(row % 13);
+    for (size_t col = 0; col < cols; ++col)
+        scale_values[col] = 0.25f * static_cast<float>(col % 7 + 1);
+
+    expected.resize(weights_values.size());
+    for (size_t row = 0; row < rows; ++row) {
+        for (size_t col = 0; col < cols; ++col) {
+            const auto i = row * cols + col;
+            expected[i] = (static_cast<float>(weights_values[i]) - zero_point_values[row]) * scale_values[col];
+        }
+    }
+
+    auto weights = std::make_shared<ov::opset11::Constant>(ov::element::u8, shape, weights_values);
+    auto convert = std::make_shared<ov::opset11::Convert>(weights, ov::element::f32);
+    auto zero_point = std::make_shared<ov::opset11::Constant>(ov::element::f32, ov::Shape{rows, 1}, zero_point_values);
+    auto subtract = std::make_shared<ov::opset11::Subtract>(convert, zero_point);
+    auto scale = std::make_shared<ov::opset11::Constant>(ov::element::f32, ov::Shape{1, cols}, scale_values);
+    auto multiply = std::make_shared<ov::opset11::Multiply>(subtract, scale);
+    multiply->set_friendly_name(name);
+    return multiply;
+}
+
+void check_values(const std::shared_ptr<ov::op::v0::Constant>& constant, const std::vector<float>& expected) {
+    const auto values = constant->cast_vector<float>();
+    ASSERT_EQ(values.size(), expected.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], expected[i]) << "at " << i;
+    }
+}
+}  // namespace
+
+TEST(constant_folding, large_independent_nodes) {
+    // the weights are large enough to be folded by several threads, the dims are not multiples of
+    // the transposed tiles and the concatenated inputs have different sizes
+    const ov::Shape shape_a{515, 123}, shape_b{515, 300};
+    std::vector<float> expected_a, expected_b;
+    auto weights_a = make_decompression(shape_a, 3, "weights_a", expected_a);
+    auto weights_b = make_decompression(shape_b, 5, "weights_b", expected_b);
+    auto order = ov::opset11::Constant::create(ov::element::i64, ov::Shape{2}, {1, 0});
+    auto transpose = std::make_shared<ov::opset11::Transpose>(weights_b, order);
+    transpose->set_friendly_name("transpose");
+    auto concat = std::make_shared<ov::opset11::Concat>(ov::OutputVector{weights_a, weights_b}, 1);
+    concat->set_friendly_name("concat");
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{transpose, concat}, ov::ParameterVector{});
+
+    run_constant_folding(model);
+
+    EXPECT_EQ(count_ops_of_type<ov::opset11::Convert>(model), 0);
+    EXPECT_EQ(count_ops_of_type<ov::opset11::Multiply>(model), 0);
+    EXPECT_EQ(count_ops_of_type<ov::opset11::Transpose>(model), 0);
+    EXPECT_EQ(count_ops_of_type<ov::opset11::Concat>(model), 0);
+
+    const size_t rows = shape_b[0], cols_a = shape_a[1], cols_b = shape_b[1];
+    std::vector<float> expected_transposed(expected_b.size());
+    for (size_t row = 0; row < rows; ++row) {
+        for (size_t col = 0; col < cols_b; ++col)
+            expected_transposed[col * rows + row] = expected_b[row * cols_b + col];
+    }
+    auto transposed = get_result_constant(model, 0);
+    ASSERT_TRUE(transposed);
+    EXPECT_EQ(transposed->get_friendly_name(), "transpose");
+    ASSERT_EQ(transposed->get_shape(), (ov::Shape{cols_b, rows}));
+    check_values(transposed, expected_transposed);
+
+    std::vector<float> expected_concatenated;
+    for (size_t row = 0; row < rows; ++row) {
+        expected_concatenated.insert(expected_concatenated.end(),
+                                     expected_a.begin() + row * cols_a,
+                                     expected_a.begin() + (row + 1) * cols_a);
+        expected_concatenated.insert(expected_concatenated.end(),
+                                     expected_b.begin() + row * cols_b,
+                                     expected_b.begin() + (row + 1) * cols_b);
+    }
+    auto concatenated = get_result_constant(model, 1);
+    ASSERT_TRUE(concatenated);
+    EXPECT_EQ(concatenated->get_friendly_name(), "concat");
+    ASSERT_EQ(concatenated->get_shape(), (ov::Shape{rows, cols_a + cols_b}));
+    check_values(concatenated, expected_concatenated);
+}
+
+TEST(constant_folding, large_broadcast_and_tile) {
+    // the outputs are filled by several threads in chunks of the innermost rows, the number of the rows is not
+    // a multiple of the inner dims, so the chunks start in the middle of the outer dims
+    std::vector<float> broadcast_values(37);
+    std::iota(broadcast_values.begin(), broadcast_values.end(), 1.f);
+    auto broadcast_data = std::make_shared<ov::opset11::Constant>(ov::element::f32, ov::Shape{37, 1}, broadcast_values);
+    auto target_shape = ov::opset11::Constant::create(ov::element::i64, ov::Shape{3}, {1009, 37, 4});
+    auto broadcast = std::make_shared<ov::opset11::Broadcast>(broadcast_data, target_shape);
+    broadcast->set_friendly_name("broadcast");
+
+    const ov::Shape tile_shape{5, 37, 3};
+    std::vector<float> tile_values(shape_size(tile_shape));
+    std::iota(tile_values.begin(), tile_values.end(), 1.f);
+    auto tile_data = std::make_shared<ov::opset11::Constant>(ov::element::f32, tile_shape, tile_values);
+    auto repeats = ov::opset11::Constant::create(ov::element::i64, ov::Shape{4}, {23, 11, 1, 1});
+    auto tile = std::make_shared<ov::opset11::Tile>(tile_data, repeats);
+    tile->set_friendly_name("tile");
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{broadcast, tile}, ov::ParameterVector{});
+
+    run_constant_folding(model);
+
+    EXPECT_EQ(count_ops_of_type<ov::opset11::Broadcast>(model), 0);
+    EXPECT_EQ(count_ops_of_type<ov::opset11::Tile>(model), 0);
+
+    std::vector<float> expected_broadcast;
+    for (size_t i = 0; i < 1009; ++i) {
+        for (size_t j = 0; j < 37; ++j)
+            expected_broadcast.insert(expected_broadcast.end(), 4, broadcast_values[j]);
+    }
+    auto broadcasted = get_result_constant(model, 0);
+    ASSERT_TRUE(broadcasted);
+    EXPECT_EQ(broadcasted->get_friendly_name(), "broadcast");
+    ASSERT_EQ(broadcasted->get_shape(), (ov::Shape{1009, 37, 4}));
+    check_values(broadcasted, expected_broadcast);
+
+    std::vector<float> expected_tile;
+    for (size_t i = 0; i < 23; ++i) {
+        for (size_t j = 0; j < 55; ++j) {
+            const auto row_begin = tile_values.begin() + (j % 5) * 37 * 3;
+            expected_tile.insert(expected_tile.end(), row_begin, row_begin + 37 * 3);
+        }
+    }
+    auto tiled = get_result_constant(model, 1);
+    ASSERT_TRUE(tiled);
+    EXPECT_EQ(tiled->get_friendly_name(), "tile");
+    ASSERT_EQ(tiled->get_shape(), (ov::Shape{23, 55, 37, 3}));
+    check_values(tiled, expected_tile);
+}
+
+// Reports the time of folding of the large weights per operation type,
+// run with --gtest_also_run_disabled_tests --gtest_filter=*benchmark_large_weights*
+TEST(constant_folding, DISABLED_benchmark_large_weights) {
+    const ov::Shape shape{4096, 4096};
+    const size_t weights_count = 4;
+
+    struct Case {
+        std::string name;
+        ov::element::Type weights_type;
+        ov::Shape weights_shape;
+        std::function<std::shared_ptr<ov::Node>(const ov::Output<ov::Node>&)> make;
+    };
+    const std::vector<Case> cases{
+        {"Convert u8 -> f32",
+         ov::element::u8,
+         shape,
+         [](const ov::Output<ov::Node>& weights) {
+             return std::make_shared<ov::opset11::Convert>(weights, ov::element::f32);
+         }},
+        {"Convert f32 -> f16",
+         ov::element::f32,
+         shape,
+         [](const ov::Output<ov::Node>& weights) {
+             return std::make_shared<ov::opset11::Convert>(weights, ov::element::f16);
+         }},
+        {"Subtract per channel",
+         ov::element::f32,
+         shape,
+         [&](const ov::Output<ov::Node>& weights) {
+             auto zero_point = ov::opset11::Constant::create(ov::element::f32, ov::Shape{shape[0], 1}, {1.f});
+             return std::make_shared<ov::opset11::Subtract>(weights, zero_point);
+         }},
+        {"Multiply by scalar",
+         ov::element::f32,
+         shape,
+         [](const ov::Output<ov::Node>& weights) {
+             auto scale = ov::opset11::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+             return std::make_shared<ov::opset11::Multiply>(weights, scale);
+         }},
+        {"Transpose",
+         ov::element::f32,
+         shape,
+         [](const ov::Output<ov::Node>& weights) {
+             auto order = ov::opset11::Constant::create(ov::element::i64, ov::Shape{2}, {1, 0});
+             return std::make_shared<ov::opset11::Transpose>(weights, order);
+         }},
+        {"Broadcast",
+         ov::element::f32,
+         ov::Shape{1, shape[1]},
+         [&](const ov::Output<ov::Node>& weights) {
+             auto target_shape = ov::opset11::Constant::create(ov::element::i64, ov::Shape{2}, shape);
+             return std::make_shared<ov::opset11::Broadcast>(weights, target_shape);
+         }},
+        {"Concat",
+         ov::element::f32,
+         shape,
+         [](const ov::Output<ov::Node>& weights) {
+             return std::make_shared<ov::opset11::Concat>(ov::OutputVector{weights, weights}, 0);
+         }},
+    };
+
+    std::cout << "Folding of " << weights_count << " independent nodes:" << std::endl;
+    for (const auto& test_case : cases) {
+        ov::NodeVector outputs;
+        for (size_t i = 0; i < weights_count; ++i) {
+            auto weights = ov::opset11::Constant::create(test_case.weights_type, test_case.weights_shape, {i});
+            outputs.push_back(test_case.make(weights));
+        }
+        auto model = std::make_shared<ov::Model>(outputs, ov::ParameterVector{});
+
+        const auto start = std::chrono::steady_clock::now();
+        ov::pass::ConstantFolding().run_on_model(model);
+        const auto duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        for (const auto& result : model->get_results())
+            ASSERT_TRUE(ov::is_type<ov::opset11::Constant>(result->get_input_node_ptr(0))) << test_case.name;
+        std::cout << "    " << test_case.name << " " << test_case.weights_shape << ": " << duration.count() << " ms"
+                  << std::endl;
+    }
+}
@@ -2135,3 +2135,39 @@ TEST(model, create_model) {
     EXPECT_THROW(ov::Model(ov::ResultVector{}, {}, {}, {nullptr}, ""), ov::Exception);
     EXPECT_THROW(ov::Model(ov::OutputVector{ov::Output<ov::Node>{nullptr, 0}}, {}, {}, {}, ""), ov::Exception);
 }
+
+TEST(model, validate_changed_nodes_and_infer_types) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(data);
+    auto abs = std::make_shared<ov::opset8::Abs>(relu);
+    auto data2 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{2});
+    auto neg = std::make_shared<ov::opset8::Negative>(data2);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{abs, neg}, ov::ParameterVector{data, data2});
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(model->validate_changed_nodes_and_infer_types(), size_t{0});
+
+    // the new node, its consumer and the result are validated, the second branch is not
+    auto convert = std::make_shared<ov::opset8::Convert>(relu, ov::element::f16);
+    abs->input(0).replace_source_output(convert);
+    EXPECT_EQ(model->validate_changed_nodes_and_infer_types(), size_t{3});
+    EXPECT_EQ(model->output(0).get_element_type(), ov::element::f16);
+    EXPECT_EQ(model->output(1).get_element_type(), ov::element::f32);
+    EXPECT_EQ(model->validate_changed_nodes_and_infer_types(), size_t{0});
+
+    // the replaced node is not a part of the model anymore
+    auto sqrt = std::make_shared<ov::opset8::Sqrt>(data2);
+    ov::replace_node(neg, sqrt);
+    EXPECT_EQ(model->validate_changed_nodes_and_infer_types(), size_t{2});
+    EXPECT_EQ(model->validate_changed_nodes_and_infer_types(), size_t{0});
+}
+
+TEST(model, validate_changed_nodes_and_infer_types_after_full_validation) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(data);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{data});
+
+    auto abs = std::make_shared<ov::opset8::Abs>(data);
+    relu->input(0).replace_source_output(abs);
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(model->validate_changed_nodes_and_infer_types(), size_t{0});
+}
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/model_evaluator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "openvino/opsets/opset8.hpp"
+
+namespace {
+
+// ((x + 1) * 2 - 3) * 2, where every intermediate value is used once
+std::shared_ptr<ov::Model> make_chain(const ov::PartialShape& shape) {
+    auto x = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    auto one = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {1.f});
+    auto two = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {2.f});
+    auto three = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {3.f});
+    auto add = std::make_shared<ov::opset8::Add>(x, one);
+    auto mul = std::make_shared<ov::opset8::Multiply>(add, two);
+    auto sub = std::make_shared<ov::opset8::Subtract>(mul, three);
+    auto mul2 = std::make_shared<ov::opset8::Multiply>(sub, two);
+    return std::make_shared<ov::Model>(ov::NodeVector{mul2}, ov::ParameterVector{x});
+}
+
+std::vector<float> expected_chain(const std::vector<float>& input) {
+    std::vector<float> output;
+    for (const auto x : input)
+        output.push_back(((x + 1.f) * 2.f - 3.f) * 2.f);
+    return output;
+}
+
+}  // namespace
+
+TEST(model_evaluator, reuses_intermediate_buffers) {
+    const ov::Shape shape{2, 3};
+    auto model = make_chain(shape);
+    ov::ModelEvaluator evaluator(*model);
+
+    // three intermediate values, but at most two of them are alive at once
+    EXPECT_EQ(evaluator.get_buffers_byte_size(), 2 * ov::shape_size(shape) * sizeof(float));
+
+    for (const float shift : {0.f, 10.f}) {
+        std::vector<float> input_data{0.f, 1.f, 2.f, 3.f, 4.f, 5.f};
+        for (auto& x : input_data)
+            x += shift;
+        ov::Tensor input(ov::element::f32, shape, input_data.data());
+        ov::Tensor output(ov::element::f32, shape);
+        ov::TensorVector outputs{output};
+        ASSERT_TRUE(evaluator.evaluate(outputs, ov::TensorVector{input}));
+
+        ASSERT_EQ(outputs[0].data(), output.data());
+        const auto* result = outputs[0].data<const float>();
+        EXPECT_EQ(std::vector<float>(result, result + ov::shape_size(shape)), expected_chain(input_data));
+    }
+}
+
+TEST(model_evaluator, dynamic_shapes) {
+    auto model = make_chain(ov::PartialShape::dynamic(2));
+    ov::ModelEvaluator evaluator(*model);
+    EXPECT_EQ(evaluator.get_buffers_byte_size(), size_t{0});
+
+    for (const auto& shape : {ov::Shape{1, 2}, ov::Shape{2, 2}}) {
+        std::vector<float> input_data(ov::shape_size(shape));
+        for (size_t i = 0; i < input_data.size(); ++i)
+            input_data[i] = static_cast<float>(i);
+        ov::Tensor input(ov::element::f32, shape, input_data.data());
+        ov::TensorVector outputs{ov::Tensor()};
+        ASSERT_TRUE(evaluator.evaluate(outputs, ov::TensorVector{input}));
+
+        ASSERT_EQ(outputs[0].get_shape(), shape);
+        const auto* result = outputs[0].data<const float>();
+        EXPECT_EQ(std::vector<float>(result, result + ov::shape_size(shape)), expected_chain(input_data));
+    }
+}
+
+TEST(model_evaluator, value_used_by_several_nodes_is_not_overwritten) {
+    const ov::Shape shape{4};
+    auto x = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    auto relu = std::make_shared<ov::opset8::Relu>(x);
+    auto neg = std::make_shared<ov::opset8::Negative>(relu);
+    auto abs = std::make_shared<ov::opset8::Abs>(neg);
+    auto add = std::make_shared<ov::opset8::Add>(relu, abs);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{add, neg}, ov::ParameterVector{x});
+    ov::ModelEvaluator evaluator(*model);
+
+    std::vector<float> input_data{-1.f, 0.f, 1.f, 2.f};
+    ov::TensorVector outputs{ov::Tensor(ov::element::f32, shape), ov::Tensor(ov::element::f32, shape)};
+    ASSERT_TRUE(evaluator.evaluate(outputs, ov::TensorVector{ov::Tensor(ov::element::f32, shape, input_data.data())}));
+
+    const auto* sum = outputs[0].data<const float>();
+    const auto* negative = outputs[1].data<const float>();
+    EXPECT_EQ(std::vector<float>(sum, sum + 4), (std::vector<float>{0.f, 0.f, 2.f, 4.f}));
+    EXPECT_EQ(std::vector<float>(negative, negative + 4), (std::vector<float>{0.f, 0.f, -1.f, -2.f}));
+}
+
+namespace {
+std::vector<float> evaluate_model(const std::shared_ptr<ov::Model>& model, std::vector<float> input_data) {
+    const ov::Shape shape{input_data.size()};
+    ov::TensorVector outputs{ov::Tensor()};
+    EXPECT_TRUE(model->evaluate(outputs, ov::TensorVector{ov::Tensor(ov::element::f32, shape, input_data.data())}));
+    const auto* result = outputs[0].data<const float>();
+    return std::vector<float>(result, result + outputs[0].get_size());
+}
+}  // namespace
+
+TEST(model_evaluator, model_evaluate_follows_topology_changes) {
+    auto model = make_chain(ov::Shape{3});
+    EXPECT_EQ(evaluate_model(model, {0.f, 1.f, 2.f}), expected_chain({0.f, 1.f, 2.f}));
+    EXPECT_EQ(evaluate_model(model, {3.f, 4.f, 5.f}), expected_chain({3.f, 4.f, 5.f}));
+
+    // (x + 1) * 2 - 3 becomes (x + 1) * 2 - 4
+    auto sub = model->get_result()->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0);
+    std::weak_ptr<ov::Node> three = sub->get_input_node_shared_ptr(1);
+    sub->input(1).replace_source_output(ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {4.f}));
+    EXPECT_EQ(evaluate_model(model, {0.f, 1.f, 2.f}), (std::vector<float>{-2.f, 2.f, 6.f}));
+    // the kept evaluation plan doesn't hold the removed nodes
+    EXPECT_TRUE(three.expired());
+}
+
+TEST(model_evaluator, model_evaluate_follows_shape_changes) {
+    auto model = make_chain(ov::Shape{3});
+    EXPECT_EQ(evaluate_model(model, {0.f, 1.f, 2.f}), expected_chain({0.f, 1.f, 2.f}));
+
+    // the topology is the same, but the intermediate buffers must be planned for the new shape
+    model->get_parameters()[0]->set_partial_shape(ov::Shape{5});
+    model->validate_nodes_and_infer_types();
+    const std::vector<float> input{0.f, 1.f, 2.f, 3.f, 4.f};
+    EXPECT_EQ(evaluate_model(model, input), expected_chain(input));
+}
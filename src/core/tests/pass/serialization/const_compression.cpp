@@ -4,7 +4,10 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <fstream>
+#include <iostream>
+#include <vector>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/test_common.hpp"
@@ -213,3 +216,41 @@ TEST_F(SerializationConstantCompressionTest, IdenticalConstantsDifferentTypesI32
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializationConstantCompressionTest, IdenticalLargeConstants) {
+    // the constants are larger than the block of the parallel hashing
+    const ov::Shape shape{3, 1024, 1024};
+    std::vector<float> data(ov::shape_size(shape), 1.f);
+
+    auto A = ov::opset8::Constant::create(ov::element::f32, shape, data);
+    auto B = ov::opset8::Constant::create(ov::element::f32, shape, data);
+    data.back() = 2.f;
+    auto C = ov::opset8::Constant::create(ov::element::f32, shape, data);
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_EQ(file_size(bin_1), 2 * ov::shape_size(shape) * sizeof(float));
+}
+
+TEST_F(SerializationConstantCompressionTest, DISABLED_benchmark_large_model) {
+    // 2 GB of the constants, a quarter of them are the duplicates
+    constexpr size_t constant_count = 128;
+    const ov::Shape shape{4096, 1024};
+    ov::NodeVector constants;
+    for (size_t i = 0; i < constant_count; ++i) {
+        std::vector<float> data(ov::shape_size(shape), static_cast<float>(i % (constant_count * 3 / 4)));
+        constants.push_back(ov::opset8::Constant::create(ov::element::f32, shape, data));
+    }
+    auto model = std::make_shared<ov::Model>(constants, ov::ParameterVector{});
+    const auto bytes = constant_count * ov::shape_size(shape) * sizeof(float);
+
+    const auto start = std::chrono::steady_clock::now();
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model);
+    const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    std::cout << "Serialize: " << bytes / time.count() / (1 << 30) << " GB/s of the constants data, " << time.count()
+              << " s" << std::endl;
+}
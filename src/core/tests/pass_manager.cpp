@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -13,6 +14,9 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/manager.hpp"
+#include "pass/perf_counters.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -42,3 +46,118 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+class ChangeModel : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("ChangeModel");
+    explicit ChangeModel(std::function<bool(const std::shared_ptr<ov::Model>&)> callback)
+        : m_callback(std::move(callback)) {}
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        return m_callback(model);
+    }
+
+private:
+    std::function<bool(const std::shared_ptr<ov::Model>&)> m_callback;
+};
+
+class InspectModel : public ChangeModel {
+public:
+    OPENVINO_RTTI("InspectModel", "0", ChangeModel);
+    using ChangeModel::ChangeModel;
+};
+}  // namespace
+
+// the nodes of a new model are validated as changed ones, so the models are validated before the passes
+
+// the per pass validations are incremental, the shape set in place is propagated by the full validation at the end
+// although the last Validate is skipped as the pass before it changed nothing
+TEST(pass_manager, validate_in_place_changes_before_unchanged_pass) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(data);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{data});
+    model->validate_nodes_and_infer_types();
+
+    ov::pass::Manager manager;
+    manager.register_pass<ChangeModel>([&](const std::shared_ptr<ov::Model>&) {
+        data->set_partial_shape(ov::PartialShape{2, 3});
+        return true;
+    });
+    manager.register_pass<InspectModel>([](const std::shared_ptr<ov::Model>&) {
+        return false;
+    });
+    manager.run_passes(model);
+
+    EXPECT_EQ(relu->get_output_partial_shape(0), (ov::PartialShape{2, 3}));
+    EXPECT_EQ(model->output(0).get_partial_shape(), (ov::PartialShape{2, 3}));
+}
+
+TEST(pass_manager, validate_changed_multi_subgraph_op_body) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto body_data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape::dynamic());
+    auto body_relu = std::make_shared<ov::opset8::Relu>(body_data);
+    auto body_condition = std::make_shared<ov::opset8::Constant>(ov::element::boolean, ov::Shape{}, true);
+    auto body = std::make_shared<ov::Model>(ov::OutputVector{body_relu, body_condition}, ov::ParameterVector{body_data});
+
+    auto trip_count = std::make_shared<ov::opset8::Constant>(ov::element::i64, ov::Shape{}, 1);
+    auto exec_condition = std::make_shared<ov::opset8::Constant>(ov::element::boolean, ov::Shape{}, true);
+    auto loop = std::make_shared<ov::opset8::Loop>(trip_count, exec_condition);
+    loop->set_function(body);
+    loop->set_special_body_ports(ov::opset8::Loop::SpecialBodyPorts{-1, 1});
+    loop->set_invariant_input(body_data, data);
+    auto loop_output = loop->get_iter_value(body_relu, -1);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{loop_output}, ov::ParameterVector{data});
+    model->validate_nodes_and_infer_types();
+    ASSERT_EQ(loop->get_output_element_type(0), ov::element::f32);
+
+    // the body is changed by the first pass, the Loop must be revalidated before the second one
+    ov::element::Type seen_type;
+    ov::pass::Manager manager;
+    manager.register_pass<ChangeModel>([&](const std::shared_ptr<ov::Model>&) {
+        auto convert = std::make_shared<ov::opset8::Convert>(body_relu, ov::element::f16);
+        body->get_results()[0]->input(0).replace_source_output(convert);
+        return true;
+    });
+    manager.register_pass<InspectModel>([&](const std::shared_ptr<ov::Model>&) {
+        seen_type = loop->get_output_element_type(0);
+        return false;
+    });
+    manager.run_passes(model);
+
+    EXPECT_EQ(seen_type, ov::element::f16);
+    EXPECT_EQ(model->output(0).get_element_type(), ov::element::f16);
+}
+
+TEST(pass_manager, validation_statistics) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(data);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{data});
+    model->validate_nodes_and_infer_types();
+
+    auto& counters = ov::pass::perf_counters();
+    const auto changed_before = counters.get_statistics(ChangeModel::get_type_info_static());
+    const auto inspected_before = counters.get_statistics(InspectModel::get_type_info_static());
+
+    ov::pass::Manager manager;
+    manager.register_pass<ChangeModel>([&](const std::shared_ptr<ov::Model>&) {
+        auto abs = std::make_shared<ov::opset8::Abs>(data);
+        relu->input(0).replace_source_output(abs);
+        return true;
+    });
+    manager.register_pass<InspectModel>([](const std::shared_ptr<ov::Model>&) {
+        return false;
+    });
+    manager.run_passes(model);
+
+    // Abs, Relu and Result are validated after the change, then all four nodes by the final validation,
+    // both validations are attributed to the pass which made the change
+    const auto changed = counters.get_statistics(ChangeModel::get_type_info_static());
+    EXPECT_EQ(changed.runs - changed_before.runs, size_t{1});
+    EXPECT_EQ(changed.validations - changed_before.validations, size_t{2});
+    EXPECT_EQ(changed.validated_nodes - changed_before.validated_nodes, size_t{3 + 4});
+
+    const auto inspected = counters.get_statistics(InspectModel::get_type_info_static());
+    EXPECT_EQ(inspected.runs - inspected_before.runs, size_t{1});
+    EXPECT_EQ(inspected.validations - inspected_before.validations, size_t{0});
+    EXPECT_EQ(inspected.validated_nodes - inspected_before.validated_nodes, size_t{0});
+}
@@ -202,10 +202,10 @@ public:
     Attribute() = delete;
     explicit Attribute(const ONNX_NAMESPACE::AttributeProto& attribute_proto,
                        const std::string& model_dir,
-                       const bool enable_mmap)
+                       detail::MappedMemoryHandles mmap_cache)
         : m_attribute_proto{&attribute_proto},
           m_model_dir{model_dir},
-          m_enable_mmap{enable_mmap} {}
+          m_mmap_cache{std::move(mmap_cache)} {}
 
     Attribute(Attribute&&) noexcept = default;
     Attribute(const Attribute&) = default;
@@ -256,10 +256,10 @@ public:
         return get_type() == Type::graph_array;
     }
     Tensor get_tensor() const {
-        return Tensor{m_attribute_proto->t(), m_model_dir, m_enable_mmap};
+        return Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache};
     }
     SparseTensor get_sparse_tensor() const {
-        return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_enable_mmap};
+        return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_mmap_cache};
     }
     float get_float() const {
         return m_attribute_proto->f();
@@ -277,7 +277,7 @@ public:
         const auto& tensors = m_attribute_proto->tensors();
         ret.reserve(tensors.size());
         for (const auto& tensor : tensors)
-            ret.emplace_back(tensor, m_model_dir, m_enable_mmap);
+            ret.emplace_back(tensor, m_model_dir, m_mmap_cache);
         return ret;
     }
 
@@ -286,7 +286,7 @@ public:
         const auto& sparse_tensors = m_attribute_proto->sparse_tensors();
         ret.reserve(sparse_tensors.size());
         for (const auto& tensor : sparse_tensors)
-            ret.emplace_back(tensor, m_model_dir, m_enable_mmap);
+            ret.emplace_back(tensor, m_model_dir, m_mmap_cache);
         return ret;
     }
 
@@ -318,7 +318,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, Tensor>::value, bool>::type = true>
     T get_value() const {
         if (is_tensor()) {
-            return Tensor{m_attribute_proto->t(), m_model_dir, m_enable_mmap};
+            return Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache};
         }
         throw error::attribute::InvalidData{m_attribute_proto->type()};
     }
@@ -326,7 +326,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, std::vector<Tensor>>::value, bool>::type = true>
     T get_value() const {
         if (is_tensor()) {
-            return {Tensor{m_attribute_proto->t(), m_model_dir, m_enable_mmap}};
+            return {Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache}};
         } else if (is_tensor_array()) {
             return get_tensor_array();
         }
@@ -336,7 +336,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, SparseTensor>::value, bool>::type = true>
     T get_value() const {
         if (is_sparse_tensor()) {
-            return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_enable_mmap};
+            return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_mmap_cache};
         }
         throw error::attribute::InvalidData{m_attribute_proto->type()};
     }
@@ -344,7 +344,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, std::vector<SparseTensor>>::value, bool>::type = true>
     T get_value() const {
         if (is_sparse_tensor()) {
-            return {SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_enable_mmap}};
+            return {SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_mmap_cache}};
         } else if (is_sparse_tensor_array()) {
             return get_sparse_tensor_array();
         }
@@ -356,7 +356,7 @@ public:
 private:
     const ONNX_NAMESPACE::AttributeProto* m_attribute_proto;
     std::string m_model_dir;
-    const bool m_enable_mmap;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 }  // namespace onnx_import
@@ -19,9 +19,9 @@ public:
     SparseTensor() = delete;
     SparseTensor(const ONNX_NAMESPACE::SparseTensorProto& sparse_tensor,
                  const std::string& model_dir,
-                 const bool enable_mmap)
-        : m_values{sparse_tensor.values(), model_dir, enable_mmap},
-          m_indices{sparse_tensor.indices(), model_dir, enable_mmap},
+                 detail::MappedMemoryHandles mmap_cache)
+        : m_values{sparse_tensor.values(), model_dir, mmap_cache},
+          m_indices{sparse_tensor.indices(), model_dir, mmap_cache},
           m_shape{std::begin(sparse_tensor.dims()), std::end(sparse_tensor.dims())} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a sparse tensor in ONNX with "dims: 0" property
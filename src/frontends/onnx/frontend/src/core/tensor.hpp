@@ -108,11 +108,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir, const bool enable_mmap)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
           m_model_dir{model_dir},
-          m_enable_mmap{enable_mmap} {
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -238,23 +240,11 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
-        size_t data_size = get_data_size();
         if (has_external_data()) {
-            const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
-            if (m_enable_mmap) {
-                constant = std::make_shared<ngraph::op::Constant>(type,
-                                                                  m_shape,
-                                                                  ext_data.load_external_mmap_data(m_model_dir));
-            } else {
-                constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
-            }
-            if (constant->get_byte_size() != ov::shape_size(m_shape) * type.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
-        } else if (data_size == shape_size(m_shape)) {
+            return make_external_ng_constant(type);
+        }
+        size_t data_size = get_data_size();
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -275,6 +265,9 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (has_external_data()) {
+            return make_external_ng_constant(type);
+        }
         auto data = get_data<T>();
         auto data_size = data.size();
         if (data_size == shape_size(m_shape)) {
@@ -290,6 +283,29 @@ private:
         return constant;
     }
 
+    // The external data is stored in the same binary layout for all the element types,
+    // so the constant refers to the external data buffer directly
+    std::shared_ptr<ngraph::op::Constant> make_external_ng_constant(const element::Type& type) const {
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
+        if (m_mmap_cache) {
+            constant = std::make_shared<ngraph::op::Constant>(type,
+                                                              m_shape,
+                                                              ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache));
+        } else {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
+        }
+        if (constant->get_byte_size() != ov::shape_size(m_shape) * type.size()) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() ==
@@ -300,12 +316,12 @@ private:
     std::vector<T> get_external_data() const {
         const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
         std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer = nullptr;
-        if (m_enable_mmap) {
-            buffer = ext_data.load_external_mmap_data(m_model_dir);
+        if (m_mmap_cache) {
+            buffer = ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
         } else {
             buffer = ext_data.load_external_data(m_model_dir);
         }
-        return std::vector<T>(buffer->get_ptr<char>(), buffer->get_ptr<char>() + buffer->size());
+        return std::vector<T>(buffer->get_ptr<T>(), buffer->get_ptr<T>() + buffer->size() / sizeof(T));
     }
 
     const void* get_data_ptr() const {
@@ -349,7 +365,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
-    bool m_enable_mmap = true;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
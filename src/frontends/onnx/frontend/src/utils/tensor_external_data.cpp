@@ -34,21 +34,36 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
     }
 }
 
-Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::string& model_dir) const {
+Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                                     MappedMemoryHandles cache) const {
     NGRAPH_SUPPRESS_DEPRECATED_START
     auto full_path = file_util::path_join(model_dir, m_data_location);
     NGRAPH_SUPPRESS_DEPRECATED_END
-    const int64_t file_size = ov::util::file_size(full_path);
-    if (file_size <= 0 || m_offset + m_data_length > static_cast<uint64_t>(file_size)) {
-        throw error::invalid_external_data{*this};
+    std::shared_ptr<ov::MappedMemory> mapped_memory;
+    auto cached = cache->find(full_path);
+    if (cached != cache->end()) {
+        mapped_memory = cached->second;
+    } else {
+        const int64_t file_size = ov::util::file_size(full_path);
+        if (file_size <= 0) {
+            throw error::invalid_external_data{*this};
+        }
+        // the whole file is mapped, so the initializers stored in the same file share a single mapping
+        try {
+            mapped_memory = ov::load_mmap_object(full_path);
+        } catch (const std::runtime_error&) {
+            throw error::invalid_external_data{*this};
+        }
+        (*cache)[full_path] = mapped_memory;
     }
-    auto mapped_memory = ov::load_mmap_object(full_path, m_data_length, m_offset);
-    if (m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
+    if (m_offset + m_data_length > mapped_memory->size() || m_offset >= mapped_memory->size()) {
         throw error::invalid_external_data{*this};
     }
-    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mapped_memory->data(),
-                                                                                              mapped_memory->size(),
-                                                                                              mapped_memory);
+    const uint64_t data_length = m_data_length > 0 ? m_data_length : mapped_memory->size() - m_offset;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        data_length,
+        mapped_memory);
 }
 
 Buffer<ngraph::runtime::AlignedBuffer> TensorExternalData::load_external_data(const std::string& model_dir) const {
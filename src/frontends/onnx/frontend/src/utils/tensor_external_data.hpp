@@ -6,6 +6,8 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/util/mmap_object.hpp"
 
@@ -14,6 +16,9 @@ namespace onnx_import {
 namespace detail {
 template <class T>
 using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<T>>>;
+/// \brief     The external data files mapped to memory, the key is the full path of a file.
+///             Each file is mapped once and shared by all the tensors which refer to it.
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>;
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -34,8 +39,12 @@ public:
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into the SharedBuffer
-    Buffer<ov::MappedMemory> load_external_mmap_data(const std::string& model_dir) const;
+    /// \param      model_dir  The directory of the model, the data location is relative to it.
+    /// \param      cache      The files mapped so far, the whole file is mapped and added to it
+    ///                        on the first access.
+    ///
+    /// \return     External binary data which refers to the mapped file (no copy is made)
+    Buffer<ov::MappedMemory> load_external_mmap_data(const std::string& model_dir, MappedMemoryHandles cache) const;
 
     /// \brief      Represets parameter of external data as string
     ///
@@ -274,6 +274,25 @@ TEST_P(OnnxFeMmapFixture, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+TEST(OnnxFeMmapTests, onnx_external_data_in_the_same_file_is_mapped_once) {
+    const auto path = ov::test::utils::getModelFromTestModelZoo(
+        std::string(ONNX_TEST_MODELS) + "external_data/external_data_two_tensors_data_in_the_same_file.onnx");
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    const auto model = core.read_model(path);
+
+    std::map<std::string, const char*> data;
+    for (const auto& op : model->get_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            data[constant->get_friendly_name()] = static_cast<const char*>(constant->get_data_ptr());
+        }
+    }
+    ASSERT_EQ(data.count("data_a"), 1);
+    ASSERT_EQ(data.count("data_b"), 1);
+    // both constants refer to the single mapping of the file instead of own copies or mappings
+    EXPECT_EQ(data["data_b"] - data["data_a"], 4096);
+}
+
 TEST_P(OnnxFeMmapFixture, onnx_external_invalid_external_data_exception) {
     try {
         const auto path = ov::test::utils::getModelFromTestModelZoo(std::string(ONNX_TEST_MODELS) +
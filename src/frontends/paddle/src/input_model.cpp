@@ -4,15 +4,19 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <queue>
 
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -32,7 +36,8 @@ public:
     template <typename T>
     InputModelImpl(const std::basic_string<T>& path,
                    const InputModel& input_model,
-                   const std::shared_ptr<TelemetryExtension>& telemetry);
+                   const std::shared_ptr<TelemetryExtension>& telemetry,
+                   bool mmap_enabled);
     InputModelImpl(const std::vector<std::istream*>& streams,
                    const InputModel& input_model,
                    const std::shared_ptr<TelemetryExtension>& telemetry);
@@ -61,6 +66,7 @@ private:
     template <typename T>
     void load_consts(const std::basic_string<T>& folder_with_weights);
     void load_consts(std::istream* weight_stream);
+    void load_consts(const std::shared_ptr<ov::MappedMemory>& weights);
     void create_temp_consts();
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
@@ -76,6 +82,8 @@ private:
 
     // shows if some nodes might be deleted from graph
     bool m_graph_changed = false;
+    // the constants refer to the mapped weights files instead of own copies
+    bool m_mmap_enabled = false;
 };
 
 void InputModel::InputModelImpl::load_places() {
@@ -161,6 +169,28 @@ bool read_tensor(std::istream& is, char* data, size_t len) {
     return (size_t)is.gcount() == len;
 }
 
+// Copies len bytes of the mapped weights at offset to data and moves offset after them
+void read_mapped(const std::shared_ptr<ov::MappedMemory>& memory, size_t& offset, char* data, size_t len) {
+    FRONT_END_GENERAL_CHECK(offset + len <= memory->size(), "PaddlePaddle weights file is corrupted.");
+    std::copy_n(memory->data() + offset, len, data);
+    offset += len;
+}
+
+// Creates a constant which refers to the mapped weights at offset and moves offset after the constant data
+std::shared_ptr<opset7::Constant> make_mapped_constant(const element::Type& type,
+                                                       const Shape& shape,
+                                                       const std::shared_ptr<ov::MappedMemory>& memory,
+                                                       size_t& offset) {
+    const auto data_length = shape_size(shape) * type.size();
+    FRONT_END_GENERAL_CHECK(offset + data_length <= memory->size(), "PaddlePaddle weights file is corrupted.");
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+        memory->data() + offset,
+        data_length,
+        memory);
+    offset += data_length;
+    return std::make_shared<opset7::Constant>(type, shape, buffer);
+}
+
 template <typename T>
 std::basic_string<T> get_const_path(const std::basic_string<T>& folder_with_weights, const std::string& name) {
     return folder_with_weights + paddle::get_path_sep<T>() + name;
@@ -189,6 +219,24 @@ bool is_pdmodel(const std::basic_string<wchar_t>& path) {
 }
 #endif
 
+template <typename T>
+std::basic_string<T> get_weights_path(const std::basic_string<T>& path) {
+    std::string ext = ".pdmodel";
+    std::string weights_file{path};
+    weights_file.replace(weights_file.size() - ext.size(), ext.size(), ".pdiparams");
+    return weights_file;
+}
+
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+template <>
+std::basic_string<wchar_t> get_weights_path(const std::basic_string<wchar_t>& path) {
+    std::wstring ext = L".pdmodel";
+    std::wstring weights_file{path};
+    weights_file.replace(weights_file.size() - ext.size(), ext.size(), L".pdiparams");
+    return weights_file;
+}
+#endif
+
 template <typename T>
 std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
     std::string model_file{path};
@@ -289,6 +337,21 @@ void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_
         const auto& tensor = var_desc.type().lod_tensor().tensor();
         Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
         const auto& type = get_ov_type(tensor.data_type());
+        FRONT_END_GENERAL_CHECK(!folder_with_weights.empty(), "Folder with weights must be provided.");
+        if (m_mmap_enabled) {
+            const auto const_path = get_const_path(folder_with_weights, name);
+            FRONT_END_GENERAL_CHECK(ov::util::file_exists(const_path), "Cannot open file for constant value.");
+            auto memory = ov::load_mmap_object(const_path);
+            // skip the header and the tensor description
+            size_t offset = 16;
+            uint32_t dims_len = 0;
+            read_mapped(memory, offset, reinterpret_cast<char*>(&dims_len), sizeof(dims_len));
+            offset += dims_len;
+            auto const_node = make_mapped_constant(type, shape, memory, offset);
+            const_node->set_friendly_name(name);
+            m_tensor_values[name] = const_node;
+            continue;
+        }
         const auto& data_length = shape_size(shape) * type.size();
         std::vector<uint8_t> tensor_data(data_length);
 
@@ -376,6 +439,39 @@ void InputModel::InputModelImpl::load_consts(std::istream* weight_stream) {
     }
 }
 
+// load_consts with mapped weights is the same as with stream, but the constants refer to the mapped file.
+void InputModel::InputModelImpl::load_consts(const std::shared_ptr<ov::MappedMemory>& weights) {
+    size_t offset = 0;
+    for (const auto& item : m_var_places) {
+        const auto& var_desc = item.second->get_desc();
+        const auto& name = item.first;
+        if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
+            continue;
+
+        // var_desc.persistable() is used to mark node const value or not.
+        if (!var_desc.persistable())
+            continue;
+
+        FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
+        // the header is the same as in the stream, see the description there
+        offset += 16;
+        int32_t size = 0;
+        read_mapped(weights, offset, reinterpret_cast<char*>(&size), sizeof(size));
+        FRONT_END_GENERAL_CHECK(size >= 0 && offset + size <= weights->size(),
+                                "PaddlePaddle weights file is corrupted.");
+
+        ::paddle::framework::proto::VarType_TensorDesc tensor_desc;
+        tensor_desc.ParseFromArray(weights->data() + offset, size);
+        offset += size;
+        Shape shape(tensor_desc.dims().cbegin(), tensor_desc.dims().cend());
+        const auto& type = get_ov_type(tensor_desc.data_type());
+
+        auto const_node = make_mapped_constant(type, shape, weights, offset);
+        const_node->set_friendly_name(name);
+        m_tensor_values[name] = const_node;
+    }
+}
+
 /*
     1. path: is a directory, compatible with old PaddlePaddle API.
              read __model__ as model stream.
@@ -387,10 +483,12 @@ void InputModel::InputModelImpl::load_consts(std::istream* weight_stream) {
 template <typename T>
 InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
                                            const InputModel& input_model,
-                                           const std::shared_ptr<TelemetryExtension>& telemetry)
+                                           const std::shared_ptr<TelemetryExtension>& telemetry,
+                                           bool mmap_enabled)
     : m_fw_ptr{std::make_shared<ProgramDesc>()},
       m_input_model(input_model),
-      m_telemetry(telemetry) {
+      m_telemetry(telemetry),
+      m_mmap_enabled(mmap_enabled) {
     std::ifstream weights_stream;
     std::ifstream pb_stream(get_model_path<T>(path, &weights_stream).c_str(), std::ios::in | std::ifstream::binary);
 
@@ -406,7 +504,13 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     load_places();
     if (is_pdmodel(path)) {
-        load_consts(&weights_stream);
+        const auto weights_path = get_weights_path(path);
+        if (m_mmap_enabled && ov::util::file_size(weights_path) > 0) {
+            weights_stream.close();
+            load_consts(ov::load_mmap_object(weights_path));
+        } else {
+            load_consts(&weights_stream);
+        }
     } else {
         load_consts(path);
     }
@@ -564,12 +668,16 @@ void InputModel::InputModelImpl::set_tensor_value(Place::Ptr place, const void*
     m_tensor_values[name] = constant;
 }
 
-InputModel::InputModel(const std::string& path, const std::shared_ptr<TelemetryExtension>& telemetry)
-    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry)} {}
+InputModel::InputModel(const std::string& path,
+                       const std::shared_ptr<TelemetryExtension>& telemetry,
+                       bool mmap_enabled)
+    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry, mmap_enabled)} {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-InputModel::InputModel(const std::wstring& path, const std::shared_ptr<TelemetryExtension>& telemetry)
-    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry)} {}
+InputModel::InputModel(const std::wstring& path,
+                       const std::shared_ptr<TelemetryExtension>& telemetry,
+                       bool mmap_enabled)
+    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry, mmap_enabled)} {}
 #endif
 
 InputModel::InputModel(const std::vector<std::istream*>& streams, const std::shared_ptr<TelemetryExtension>& telemetry)
@@ -40,6 +40,23 @@ TEST(Paddle_Reader_Tests, ImportBasicModelToCore) {
     ASSERT_TRUE(res.valid) << res.message;
 }
 
+TEST(Paddle_Reader_Tests, ImportModelWithWeightsMmap) {
+    auto model = FrontEndTestUtils::make_model_path(std::string(TEST_PADDLE_MODELS_DIRNAME) + "conv2d/conv2d.pdmodel");
+
+    ov::Core core;
+    core.set_property(ov::enable_mmap(false));
+    const auto reference = core.read_model(model);
+    core.set_property(ov::enable_mmap(true));
+    const auto function = core.read_model(model);
+
+    // the weights are shared with the mapped file, but the values must be the same
+    const FunctionsComparator func_comparator = FunctionsComparator::with_default()
+                                                    .enable(FunctionsComparator::NAMES)
+                                                    .enable(FunctionsComparator::CONST_VALUES);
+    const FunctionsComparator::Result res = func_comparator(function, reference);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 TEST(Paddle_Reader_Tests, ImportBasicModelToCoreWstring) {
     std::string win_dir_path{TEST_PADDLE_MODELS_DIRNAME "relu/relu.pdmodel"};
@@ -7,6 +7,7 @@
 #include "helper_ops/string_constant.hpp"
 #include "helper_ops/unsupported_constant.hpp"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/opsets/opset8.hpp"
 #include "tensor_bundle.pb.h"
 
@@ -26,15 +27,29 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
                                                const ov::Shape shape,
                                                const ::tensorflow::BundleEntryProto& entry,
                                                const NodeContext& node) {
-    std::vector<T> var_data;
     google::protobuf::int64 size = 1;
     for (uint64_t i = 0; i < shape.size(); ++i) {
         size *= static_cast<google::protobuf::int64>(shape[i]);
     }
-    var_data.resize(size);
     TENSORFLOW_OP_VALIDATION(node,
                              size == static_cast<google::protobuf::int64>(entry.size() / sizeof(T)),
                              "[TensorFlow Frontend] Internal error: Available data size isn't equal to calculated.");
+    if (entry.size() == 0) {
+        return std::make_shared<Constant>(ov_type, shape, std::vector<T>{});
+    }
+    if (auto mapped_memory = var_index->get_mapped_data_file(entry.shard_id())) {
+        TENSORFLOW_OP_VALIDATION(
+            node,
+            static_cast<uint64_t>(entry.offset() + entry.size()) <= mapped_memory->size(),
+            "[TensorFlow Frontend] Internal error: Variable data is out of the shard file.");
+        // the constant refers to the mapped shard, the shard is unmapped when all its constants are released
+        auto shared_buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+            mapped_memory->data() + entry.offset(),
+            entry.size(),
+            mapped_memory);
+        return std::make_shared<Constant>(ov_type, shape, shared_buffer);
+    }
+    std::vector<T> var_data(size);
     auto fs = var_index->get_data_file(entry.shard_id());
     if (!fs.get()) {
         TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
@@ -4,8 +4,13 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "checkpoint_utils.hpp"
 #include "graph_iterator_saved_model.hpp"
@@ -21,7 +26,50 @@ namespace ov {
 namespace frontend {
 namespace tensorflow {
 
-void VariablesIndex::read_variables_index_block(std::ifstream& fs,
+namespace {
+// Calls func(i) for each i in [0, count) using up to the hardware concurrency threads,
+// the first exception thrown by func is rethrown in the calling thread
+template <typename Func>
+void parallel_for_each(size_t count, const Func& func) {
+    const size_t threads_num =
+        std::min(count, static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+    if (threads_num <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                func(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threads_num; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+}  // namespace
+
+void VariablesIndex::read_variables_index_block(const std::vector<char>& index_data,
                                                 const VIBlock& index,
                                                 std::vector<char>& data,
                                                 uint32_t& offset,
@@ -33,8 +81,7 @@ void VariablesIndex::read_variables_index_block(std::ifstream& fs,
                             "Block offset is bigger than variables index size");
     FRONT_END_GENERAL_CHECK(index.m_offset + data.size() <= m_variables_index_size,
                             "Block size is bigger than variables index size");
-    fs.seekg(index.m_offset, std::ios::beg);
-    fs.read(data.data(), data.size());
+    std::copy_n(index_data.data() + index.m_offset, data.size(), data.data());
 #ifndef ENABLE_SNAPPY_COMPRESSION
     FRONT_END_GENERAL_CHECK(data[block_size] == 0, "Compressed files aren't supported");
 #else
@@ -89,12 +136,18 @@ void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::strin
 
     footer.read(fs);
 
+    // The index is much smaller than the data files, so it is read at once and its blocks are parsed from memory
+    std::vector<char> indexData(m_variables_index_size);
+    fs.seekg(0, std::ios::beg);
+    fs.read(indexData.data(), indexData.size());
+    FRONT_END_GENERAL_CHECK(fs, "Variables index file cannot be read");
+
     std::vector<VIBlock> secondLevel;
     std::vector<char> blockData;
 
     uint32_t offset = 0, offset_end = 0;
 
-    read_variables_index_block(fs, footer.m_index, blockData, offset, offset_end);
+    read_variables_index_block(indexData, footer.m_index, blockData, offset, offset_end);
     char *ptr = blockData.data() + offset, *ptr_end = blockData.data() + offset_end, *value = nullptr;
     std::string key = "";
     uint32_t valLength;
@@ -108,15 +161,25 @@ void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::strin
         ptr = value + valLength;
     }
 
-    for (auto& block : secondLevel) {
-        read_variables_index_block(fs, block, blockData, offset, offset_end);
+    std::vector<std::vector<std::pair<std::string, std::vector<char>>>> blockItems(secondLevel.size());
+    parallel_for_each(secondLevel.size(), [&](size_t blockIdx) {
+        std::vector<char> blockData;
+        uint32_t offset = 0, offset_end = 0;
+        read_variables_index_block(indexData, secondLevel[blockIdx], blockData, offset, offset_end);
 
-        key = "";
-        ptr = blockData.data() + offset;
-        ptr_end = blockData.data() + offset_end;
+        std::string key = "";
+        char *ptr = blockData.data() + offset, *ptr_end = blockData.data() + offset_end, *value = nullptr;
+        uint32_t valLength;
         while (ptr < ptr_end) {
             read_variables_index_pair(ptr, ptr_end, key, value, valLength);
-            varIndex[key] = std::vector<char>(value, value + valLength);
+            blockItems[blockIdx].emplace_back(key, std::vector<char>(value, value + valLength));
+        }
+    });
+
+    // the blocks are merged in the file order, so the result doesn't depend on the parsing order
+    for (auto& items : blockItems) {
+        for (auto& item : items) {
+            varIndex[item.first] = std::move(item.second);
         }
     }
 }
@@ -150,8 +213,9 @@ void VariablesIndex::read_checkpointable_object_graph() {
 
     FRONT_END_GENERAL_CHECK(entry.slices().empty(), "CMO: Slices are not supported");
 
-    auto shard = m_data_files.find(entry.shard_id());
-    FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
+    auto shard = get_data_file(entry.shard_id());
+    auto mapped_shard = get_mapped_data_file(entry.shard_id());
+    FRONT_END_GENERAL_CHECK(shard || mapped_shard, "CMO: data files isn't found");
 
     std::vector<char> data(entry.size());
     ::tensorflow::TrackableObjectGraph tog;
@@ -160,8 +224,14 @@ void VariablesIndex::read_checkpointable_object_graph() {
     // It looks like reinterpret_cast artifact
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L70
     int chg = 6;
-    shard->second->seekg(entry.offset() + chg);
-    shard->second->read(data.data(), entry.size() - chg);
+    if (mapped_shard) {
+        FRONT_END_GENERAL_CHECK(entry.offset() + entry.size() <= mapped_shard->size(),
+                                "CMO: data is out of the data file");
+        std::copy_n(mapped_shard->data() + entry.offset() + chg, entry.size() - chg, data.data());
+    } else {
+        shard->seekg(entry.offset() + chg);
+        shard->read(data.data(), entry.size() - chg);
+    }
 
     // Might be need to remove this verification:
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L73
@@ -177,12 +247,44 @@ void VariablesIndex::read_checkpointable_object_graph() {
     }
 }
 
+template <typename T>
+void VariablesIndex::open_data_files(const std::vector<std::basic_string<T>>& paths) {
+    m_data_files.clear();
+    m_mapped_data_files.clear();
+
+    std::vector<std::shared_ptr<std::ifstream>> data_files(paths.size());
+    std::vector<std::shared_ptr<ov::MappedMemory>> mapped_data_files(paths.size());
+    parallel_for_each(paths.size(), [&](size_t shard) {
+        if (m_mmap_enabled) {
+            FRONT_END_GENERAL_CHECK(ov::util::file_exists(paths[shard]), "Variable index data file does not exist");
+            // empty shards can't be mapped and don't contain variables data
+            if (ov::util::file_size(paths[shard]) > 0) {
+                mapped_data_files[shard] = ov::load_mmap_object(paths[shard]);
+            }
+            return;
+        }
+        data_files[shard] = std::shared_ptr<std::ifstream>(
+            new std::ifstream(paths[shard].c_str(), std::ifstream::in | std::ifstream::binary));
+        FRONT_END_GENERAL_CHECK(data_files[shard]->is_open(), "Variable index data file does not exist");
+    });
+
+    for (size_t shard = 0; shard < paths.size(); ++shard) {
+        if (data_files[shard]) {
+            m_data_files[static_cast<int32_t>(shard)] = data_files[shard];
+        }
+        if (mapped_data_files[shard]) {
+            m_mapped_data_files[static_cast<int32_t>(shard)] = mapped_data_files[shard];
+        }
+    }
+}
+
 bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string& path, const bool is_saved_model) {
     m_variables_index.clear();
     read_variables_index(vi_stream, m_variables_index);
     read_bundle_header();
 
     std::vector<char> suffix(20);
+    std::vector<std::string> paths;
     for (int32_t shard = 0; shard < m_total_shards; ++shard) {
         std::snprintf(suffix.data(), suffix.size(), "data-%05d-of-%05d", shard, m_total_shards);
         std::string fullPath;
@@ -191,10 +293,9 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
         } else {
             fullPath = path + "." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        paths.push_back(fullPath);
     }
+    open_data_files(paths);
 
     read_checkpointable_object_graph();
     return true;
@@ -207,6 +308,7 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
     read_bundle_header();
 
     std::vector<wchar_t> suffix(20);
+    std::vector<std::wstring> paths;
     for (int32_t shard = 0; shard < m_total_shards; ++shard) {
         swprintf_s(suffix.data(), suffix.size(), L"data-%05d-of-%05d", shard, m_total_shards);
         std::wstring fullPath;
@@ -215,10 +317,9 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
         } else {
             fullPath = path + L"." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        paths.push_back(fullPath);
     }
+    open_data_files(paths);
 
     read_checkpointable_object_graph();
     return true;
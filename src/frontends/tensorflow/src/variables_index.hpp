@@ -8,6 +8,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "saved_model.pb.h"
 
 namespace ov {
@@ -26,10 +27,19 @@ class VariablesIndex {
     std::map<std::string, std::vector<char>> m_variables_index;
     // List of opened data files for using with BundleEntryProto
     std::map<int32_t, std::shared_ptr<std::ifstream>> m_data_files;
+    // List of mapped data files, used instead of m_data_files if mapping is enabled
+    std::map<int32_t, std::shared_ptr<ov::MappedMemory>> m_mapped_data_files;
+    // Map data files into memory instead of reading them
+    bool m_mmap_enabled;
     // List of mapped variables which could be read using TrackableObjectGraph
     std::map<std::string, std::string> m_variables_map;
 
 public:
+    /// \brief Creates an empty variables index
+    /// \param mmap_enabled Map the data files into memory, so the variables can refer to the files content
+    /// instead of copying it
+    explicit VariablesIndex(bool mmap_enabled = false) : m_mmap_enabled(mmap_enabled) {}
+
     /// \brief Reads variables from opened variable index file. Can cause an asserts in case of issues.
     /// \param vi_stream Opened stream file, file pointer doesn't matter, it will be rewind internally.
     /// \param path A path to file with variables data
@@ -93,6 +103,15 @@ public:
         return result != m_data_files.end() ? result->second : nullptr;
     }
 
+    /// \brief Returns mapped memory of a requested shard_id, or nullptr in case of shard_id isn't found
+    /// or mapping is disabled
+    /// \param shard_id Requested shard_id
+    /// \returns Valid shared_ptr with the whole mapped shard file or nullptr
+    std::shared_ptr<ov::MappedMemory> get_mapped_data_file(const int32_t shard_id) const {
+        auto result = m_mapped_data_files.find(shard_id);
+        return result != m_mapped_data_files.end() ? result->second : nullptr;
+    }
+
     /// \brief Adds variable mapping to the variables map
     /// \param var_name Variable full name (from .index file)
     /// \param map_name Mapped name
@@ -118,12 +137,12 @@ public:
 
 private:
     /// \brief Reads block structure of .index file
-    /// \param[in,out] fs Filestream of .index file, position in file will be updated
+    /// \param[in] index_data Content of .index file
     /// \param[in] index Variables index block which stores information about block
     /// \param[out] data Block data will be readed
     /// \param[out] offset Offset of block start
     /// \param[out] offset_end Offset of block end
-    void read_variables_index_block(std::ifstream& fs,
+    void read_variables_index_block(const std::vector<char>& index_data,
                                     const VIBlock& index,
                                     std::vector<char>& data,
                                     uint32_t& offset,
@@ -139,10 +158,15 @@ private:
                                    std::string& key,
                                    char*& value,
                                    uint32_t& val_length);
-    /// \brief Reads .index file and stores key=value map in provided varIndex
+    /// \brief Reads .index file and stores key=value map in provided varIndex.
+    /// The second level blocks of the index are parsed in parallel.
     /// \param[in,out] fs Filestream should be parsed. Position in file will be updated
     /// \param[out] varIndex Variables indx (key=value) from given filestream
     void read_variables_index(std::ifstream& fs, std::map<std::string, std::vector<char>>& varIndex);
+    /// \brief Opens (or maps) all the data files in parallel
+    /// \param paths Paths of the data files, the index of a path is a shard_id
+    template <typename T>
+    void open_data_files(const std::vector<std::basic_string<T>>& paths);
     /// \brief Reads bundle header if it is available. Checks version and saves info about amount of shards
     void read_bundle_header();
     /// \brief Reads key=value map from storef _CHECKPOINTABLE_OBJECT_GRAPH variable
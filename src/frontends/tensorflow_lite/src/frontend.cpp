@@ -74,13 +74,15 @@ bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
 ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const {
     // Last boolean flag in `variants` (if presented) is reserved for FE configuration
     size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
+    // the flag enables mapping of the model file instead of reading it
+    const bool mmap_enabled = extra_variants_num == 1 && variants[variants.size() - 1].as<bool>();
     if (variants.size() == 1 + extra_variants_num) {
         if (variants[0].is<std::string>()) {
             std::string suffix = ".tflite";
             std::string model_path = variants[0].as<std::string>();
             if (ov::util::ends_with(model_path, suffix.c_str())) {
                 return std::make_shared<tensorflow_lite::InputModel>(
-                    std::make_shared<GraphIteratorFlatBuffer>(model_path),
+                    std::make_shared<GraphIteratorFlatBuffer>(model_path, mmap_enabled),
                     m_telemetry);
             }
         }
@@ -90,7 +92,7 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
             std::wstring model_path = variants[0].as<std::wstring>();
             if (ov::util::ends_with(model_path, suffix)) {
                 return std::make_shared<tensorflow_lite::InputModel>(
-                    std::make_shared<GraphIteratorFlatBuffer>(model_path),
+                    std::make_shared<GraphIteratorFlatBuffer>(model_path, mmap_enabled),
                     m_telemetry);
             }
         }
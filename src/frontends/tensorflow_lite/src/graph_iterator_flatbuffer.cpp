@@ -12,19 +12,25 @@ using namespace ov::frontend::tensorflow_lite;
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
-    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path)) {}
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled)
+    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path), mmap_enabled) {}
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled) {
+    if (mmap_enabled) {
+        FRONT_END_GENERAL_CHECK(ov::util::file_exists(path), "Model file does not exist: ", path);
+        m_mapped_model = ov::load_mmap_object(path);
+        m_model = tflite::GetModel(m_mapped_model->data());
+    } else {
+        std::ifstream model_file(path, std::ios::binary | std::ios::in);
+        FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
 
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
+        m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
+        model_file.close();
 
-    m_model = tflite::GetModel(m_data.data());
+        m_model = tflite::GetModel(m_data.data());
+    }
     auto sub_graphs = m_model->subgraphs();
     m_subgraphs = {sub_graphs->begin(), sub_graphs->end()};
     m_graph = m_subgraphs[0];
@@ -47,6 +53,7 @@ std::shared_ptr<GraphIteratorFlatBuffer> GraphIteratorFlatBuffer::get_subgraph(c
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
     iterator->m_model = m_model;
+    iterator->m_mapped_model = m_mapped_model;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
     const auto operators = iterator->m_graph->operators();
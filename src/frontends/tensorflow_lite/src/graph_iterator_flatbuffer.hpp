@@ -9,6 +9,7 @@
 #include "openvino/core/any.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -24,6 +25,8 @@ struct TensorInfo {
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
     std::vector<uint8_t> m_data;
+    // the model file mapped to memory, used instead of m_data if mapping is enabled
+    std::shared_ptr<ov::MappedMemory> m_mapped_model;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -31,10 +34,10 @@ class GraphIteratorFlatBuffer {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::string& path);
+    explicit GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled = false);
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    explicit GraphIteratorFlatBuffer(const std::wstring& path);
+    explicit GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled = false);
 #endif
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
@@ -62,6 +65,12 @@ public:
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderFlatBuffer> get_decoder() const;
 
+    /// \brief Returns the mapped model file or nullptr if the model was read into memory.
+    /// The buffers of the constant tensors point into this memory, so the constants can share it.
+    std::shared_ptr<ov::MappedMemory> get_mapped_model() const {
+        return m_mapped_model;
+    }
+
     /// \brief Returns the number of sub-graphs that can be enumerated with get_subgraph
     size_t get_subgraph_size() const;
 
@@ -7,6 +7,7 @@
 #include <iterator>
 #include <queue>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
@@ -64,6 +65,9 @@ public:
 private:
     void load_model();
     void clean_up();
+    std::shared_ptr<ov::op::v0::Constant> create_constant(const ov::element::Type& type,
+                                                          const ov::Shape& shape,
+                                                          const void* data) const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
     std::map<std::string, std::shared_ptr<OpPlace>> m_op_places_map;
@@ -78,6 +82,26 @@ private:
     std::shared_ptr<TelemetryExtension> m_telemetry;
 };
 
+std::shared_ptr<ov::op::v0::Constant> InputModel::InputModelTFLiteImpl::create_constant(const ov::element::Type& type,
+                                                                                       const ov::Shape& shape,
+                                                                                       const void* data) const {
+    const auto mapped_model = m_graph_iterator->get_mapped_model();
+    const auto byte_size = (ov::shape_size(shape) * type.bitwidth() + 7) / 8;
+    if (mapped_model) {
+        const auto begin = mapped_model->data();
+        const auto ptr = static_cast<const char*>(data);
+        if (ptr >= begin && ptr + byte_size <= begin + mapped_model->size()) {
+            // the constant refers to the mapped model instead of copying the buffer
+            auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                const_cast<char*>(ptr),
+                byte_size,
+                mapped_model);
+            return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
+
 void InputModel::InputModelTFLiteImpl::load_model() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
 
@@ -110,9 +134,8 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant =
+                        create_constant(place->get_element_type(), place->get_partial_shape().to_shape(), data);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "openvino/frontend/manager.hpp"
+#include "openvino/opsets/opset10.hpp"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov::frontend;
+
+namespace {
+const std::string model_name = "2in_2out/2in_2out.tflite";
+
+std::shared_ptr<ov::Model> read_model(const std::string& path, bool mmap_enabled, bool decode = false) {
+    FrontEndManager fem;
+    auto frontend = fem.load_by_framework(TF_LITE_FE);
+    auto input_model = frontend->load(path, mmap_enabled);
+    return decode ? frontend->decode(input_model) : frontend->convert(input_model);
+}
+
+ov::TensorVector evaluate(const std::shared_ptr<ov::Model>& model) {
+    ov::TensorVector inputs;
+    for (const auto& parameter : model->get_parameters()) {
+        ov::Tensor input(parameter->get_element_type(), parameter->get_shape());
+        auto* data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<float>(i % 7) - 3.f;
+        inputs.push_back(input);
+    }
+    ov::TensorVector outputs(model->get_output_size());
+    EXPECT_TRUE(model->evaluate(outputs, inputs));
+    return outputs;
+}
+}  // namespace
+
+TEST(TFLiteMmapTest, MmapModelMatchesReadModel) {
+    const auto path = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) + model_name);
+    const auto reference = read_model(path, false);
+    const auto model = read_model(path, true);
+
+    const auto comparator = FunctionsComparator::with_default()
+                                .enable(FunctionsComparator::NAMES)
+                                .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = comparator(model, reference);
+    ASSERT_TRUE(res.valid) << res.message;
+
+    const auto expected = evaluate(reference);
+    const auto outputs = evaluate(model);
+    ASSERT_EQ(outputs.size(), expected.size());
+    for (size_t i = 0; i < outputs.size(); i++) {
+        ASSERT_EQ(outputs[i].get_shape(), expected[i].get_shape());
+        ASSERT_EQ(outputs[i].get_byte_size(), expected[i].get_byte_size());
+        EXPECT_EQ(std::memcmp(outputs[i].data(), expected[i].data(), outputs[i].get_byte_size()), 0)
+            << "output: " << i;
+    }
+}
+
+// the constants of the decoded model are made of the model buffers only, with mmap they must point into a single
+// image of the model file rather than into their own copies
+TEST(TFLiteMmapTest, ConstantsAliasMappedModel) {
+    const auto path = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) + model_name);
+    std::ifstream file(path, std::ios::binary);
+    ASSERT_TRUE(file.is_open()) << path;
+    const std::vector<char> file_data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    const auto model = read_model(path, true, true);
+    // the addresses of the file beginning which agree with all the constants seen so far
+    std::set<uintptr_t> file_begins;
+    size_t constants = 0;
+    for (const auto& node : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::opset10::Constant>(node);
+        if (!constant || constant->get_byte_size() == 0)
+            continue;
+        const auto* data = static_cast<const char*>(constant->get_data_ptr());
+        std::set<uintptr_t> begins;
+        for (auto it = file_data.begin();; ++it) {
+            it = std::search(it, file_data.end(), data, data + constant->get_byte_size());
+            if (it == file_data.end())
+                break;
+            const auto begin = reinterpret_cast<uintptr_t>(data) - static_cast<uintptr_t>(it - file_data.begin());
+            if (constants == 0 || file_begins.count(begin))
+                begins.insert(begin);
+        }
+        ASSERT_FALSE(begins.empty()) << "Constant " << constant->get_friendly_name()
+                                     << " does not alias the mapped model";
+        file_begins = std::move(begins);
+        constants++;
+    }
+    ASSERT_GT(constants, size_t{1});
+}
@@ -12,6 +12,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -128,10 +129,111 @@ public:
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * Two heuristics are applied and the solution requiring less memory is kept.
      * @return Size of common memory blob required for storing all
      */
     int64_t solve() {
         maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+        // must be done first since the pop up heuristic reuses the box ids
+        std::map<int64_t, int64_t> bestFitOffsets;
+        int64_t bestFitRequired = solveBestFit(bestFitOffsets, [](const Box* l, const Box* r) {
+            // the longer living boxes first among the same size ones, they constrain the placement more
+            return l->size > r->size || (l->size == r->size && l->finish - l->start > r->finish - r->start);
+        });
+        std::map<int64_t, int64_t> byStartOffsets;
+        const int64_t byStartRequired = solveBestFit(byStartOffsets, [](const Box* l, const Box* r) {
+            return l->start < r->start || (l->start == r->start && l->size > r->size);
+        });
+        if (byStartRequired < bestFitRequired) {
+            bestFitOffsets.swap(byStartOffsets);
+            bestFitRequired = byStartRequired;
+        }
+
+        const int64_t popUpRequired = solvePopUp();
+        if (bestFitRequired < popUpRequired) {
+            _offsets.swap(bestFitOffsets);
+            return bestFitRequired;
+        }
+        return popUpRequired;
+    }
+
+    /** Provides calculated offset for specified box id */
+    int64_t getOffset(int id) const {
+        auto res = _offsets.find(id);
+        if (res == _offsets.end())
+            IE_THROW() << "There are no box for provided ID";
+        return res->second;
+    }
+
+    /** Additional info. Max sum of box sizes required for any time stamp. */
+    int64_t maxDepth() {
+        if (_depth == -1)
+            calcDepth();
+        return _depth;
+    }
+    /** Additional info. Max num of boxes required for any time stamp. */
+    int64_t maxTopDepth() {
+        if (_top_depth == -1)
+            calcDepth();
+        return _top_depth;
+    }
+
+private:
+    std::vector<Box> _boxes;
+    std::map<int64_t, int64_t> _offsets;
+    int64_t _top_depth = -1;
+    int64_t _depth = -1;
+    int _time_duration = -1;
+
+    /**
+     * @brief Greedy placement: the boxes are placed in the given order, every box is put to the smallest gap
+     * between the boxes alive at the same time which fits it (best fit), or on top of them.
+     */
+    template <typename Compare>
+    int64_t solveBestFit(std::map<int64_t, int64_t>& offsets, Compare compare) const {
+        std::vector<const Box*> order;
+        order.reserve(_boxes.size());
+        for (const Box& box : _boxes)
+            order.push_back(&box);
+        std::stable_sort(order.begin(), order.end(), compare);
+
+        // placed boxes sorted by offset
+        std::vector<std::pair<int64_t, const Box*>> placed;
+        placed.reserve(order.size());
+        int64_t min_required = 0;
+        for (const Box* box : order) {
+            int64_t prev_end = 0;
+            int64_t best_offset = -1;
+            int64_t best_gap = std::numeric_limits<int64_t>::max();
+            for (const auto& item : placed) {
+                const Box* other = item.second;
+                if (other->finish < box->start || other->start > box->finish)
+                    continue;
+                const int64_t gap = item.first - prev_end;
+                if (gap >= box->size && gap < best_gap) {
+                    best_gap = gap;
+                    best_offset = prev_end;
+                }
+                prev_end = std::max(prev_end, item.first + other->size);
+            }
+            if (best_offset == -1)
+                best_offset = prev_end;
+
+            auto pos = std::upper_bound(placed.begin(),
+                                        placed.end(),
+                                        best_offset,
+                                        [](int64_t offset, const std::pair<int64_t, const Box*>& item) {
+                                            return offset < item.first;
+                                        });
+            placed.insert(pos, {best_offset, box});
+            offsets[box->id] = best_offset;
+            min_required = std::max(min_required, best_offset + box->size);
+        }
+        return min_required;
+    }
+
+    int64_t solvePopUp() {
         std::vector<std::vector<const Box*>> time_slots(_time_duration);
         for (auto& slot : time_slots)
             slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
@@ -173,34 +275,6 @@ public:
         return _min_required;
     }
 
-    /** Provides calculated offset for specified box id */
-    int64_t getOffset(int id) const {
-        auto res = _offsets.find(id);
-        if (res == _offsets.end())
-            IE_THROW() << "There are no box for provided ID";
-        return res->second;
-    }
-
-    /** Additional info. Max sum of box sizes required for any time stamp. */
-    int64_t maxDepth() {
-        if (_depth == -1)
-            calcDepth();
-        return _depth;
-    }
-    /** Additional info. Max num of boxes required for any time stamp. */
-    int64_t maxTopDepth() {
-        if (_top_depth == -1)
-            calcDepth();
-        return _top_depth;
-    }
-
-private:
-    std::vector<Box> _boxes;
-    std::map<int64_t, int64_t> _offsets;
-    int64_t _top_depth = -1;
-    int64_t _depth = -1;
-    int _time_duration = -1;
-
     void calcDepth() {
         int64_t top_depth = 0;
         int64_t depth = 0;
@@ -48,6 +48,8 @@ public:
 
     int get_socket_id() override;
 
+    void run_on_stream(Task task, int stream_id) override;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -182,6 +182,16 @@ public:
      * @param task A task to start
      */
     virtual void execute(Task task) = 0;
+
+    /**
+     * @brief Run the task preferably in the stream with the given index, so the data used by the consecutive tasks with
+     *        the same preferred stream stays in the caches and the memory of the NUMA node of that stream.
+     *        The task may be executed by another stream if the preferred one stays busy for a while.
+     *        The default implementation ignores the preferred stream.
+     * @param task A task to start
+     * @param stream_id An index of the preferred stream
+     */
+    virtual void run_on_stream(Task task, int stream_id);
 };
 
 }  // namespace threading
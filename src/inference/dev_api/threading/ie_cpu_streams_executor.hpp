@@ -50,6 +50,8 @@ public:
 
     int GetSocketId() override;
 
+    void run_on_stream(Task task, int stream_id) override;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -63,5 +63,76 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines whether the streams of the compiled model share the compiled primitives and executors
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * By default every stream compiles its own primitives, so the compilation time and the memory footprint grow with the
+ * number of streams. When the property is set, the streams running on the same socket use one primitives cache, so each
+ * primitive is created once per socket. The repacked weights are shared per socket regardless of this property.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::shared_streams_cache(true));
+ * @endcode
+ */
+static constexpr Property<bool> shared_streams_cache{"CPU_SHARED_STREAMS_CACHE"};
+
+/**
+ * @brief This property defines whether the infer requests of the compiled model are pinned to the streams
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * By default an asynchronous inference runs in any stream which becomes free first, so the consecutive inferences of one
+ * infer request may run on different cores and NUMA nodes. When the property is set, every infer request gets a
+ * preferred stream and runs there, its input, output and state data stay in the caches of that stream. The inference
+ * is taken by another stream only if the preferred one stays busy for a while. The property is useful for the stateful
+ * and small batch models.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::sticky_streams(true));
+ * @endcode
+ */
+static constexpr Property<bool> sticky_streams{"CPU_STICKY_STREAMS"};
+
+/**
+ * @brief Read-only property to get the number of dynamic shape inferences which reused the nodes output shapes cached for
+ * the same set of the model input shapes (shape signature), so the shape inference of the nodes was skipped
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The counter is accumulated over all the streams of the compiled model. It is always zero for the models with static shapes.
+ *
+ * @code
+ * auto hits = compiled_model.get_property(ov::intel_cpu::shape_cache_hits);
+ * @endcode
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> shape_cache_hits{"CPU_SHAPE_CACHE_HITS"};
+
+/**
+ * @brief Read-only property to get the number of dynamic shape inferences which had to run the shape inference of the nodes
+ * since the shape signature was not found in the shape cache
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> shape_cache_misses{"CPU_SHAPE_CACHE_MISSES"};
+
+/**
+ * @brief Read-only property to get the size in bytes of the memory workspace planned for the intermediate tensors of
+ * a single stream of the compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The workspace holds the static tensors and the dynamic tensors with a reasonable upper bound. The memory of the other
+ * dynamic tensors is allocated on demand and is not included.
+ *
+ * @code
+ * auto size = compiled_model.get_property(ov::intel_cpu::memory_workspace_size);
+ * @endcode
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> memory_workspace_size{"CPU_MEMORY_WORKSPACE_SIZE"};
+
+/**
+ * @brief Read-only property to get the fraction of the memory workspace which is not occupied by the tensors alive at
+ * the peak moment of the inference, 0 means the workspace is not larger than the peak memory usage
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<float, PropertyMutability::RO> memory_fragmentation{"CPU_MEMORY_FRAGMENTATION"};
+
 }  // namespace intel_cpu
 }  // namespace ov
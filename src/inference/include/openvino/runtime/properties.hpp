@@ -618,6 +618,43 @@ static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
  */
 static constexpr Property<bool, PropertyMutability::RO> loaded_from_cache{"LOADED_FROM_CACHE"};
 
+/**
+ * @brief Read-write property to set the limit of the models cache size in bytes.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When the total size of the cached models exceeds the limit, the least recently used ones are removed
+ * from the cache directory. Zero value means the cache size is not limited (default).
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_max_size{"CACHE_MAX_SIZE"};
+
+/**
+ * @brief Read-write property to set the limit of the in-process memory tier of the models cache in bytes.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The recently used cached models are also kept in memory, so the repeated model compilations in the process
+ * don't access the cache directory. Zero value disables the memory tier (default).
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_memory_max_size{"CACHE_MEMORY_MAX_SIZE"};
+
+/**
+ * @brief Read-only property to get the number of the compiled models found in the models cache
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cache_hits{"CACHE_HITS"};
+
+/**
+ * @brief Read-only property to get the number of the compiled models not found in the models cache
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cache_misses{"CACHE_MISSES"};
+
+/**
+ * @brief Read-only property to get the number of the compiled models removed from the models cache
+ * to fit the ov::cache_max_size limit
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cache_evictions{"CACHE_EVICTIONS"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
@@ -657,6 +694,19 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the number of the smaller batch sizes (each is a half of the previous one) the
+ * auto-batching compiles additionally to execute the partially collected batches (instead of the batch-1 fallback)
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_sub_batches{"AUTO_BATCH_SUB_BATCHES"};
+
+/**
+ * @brief Read-only property to get the average fill rate (from 0 to 1) of the batches collected by the auto-batching
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<float, PropertyMutability::RO> auto_batch_fill_rate{"AUTO_BATCH_FILL_RATE"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
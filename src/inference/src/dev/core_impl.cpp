@@ -1166,6 +1166,16 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::cache_max_size.name()) {
+        return decltype(ov::cache_max_size)::value_type(coreConfig.get_cache_max_size());
+    } else if (name == ov::cache_memory_max_size.name()) {
+        return decltype(ov::cache_memory_max_size)::value_type(coreConfig.get_cache_memory_max_size());
+    } else if (name == ov::cache_hits.name()) {
+        return decltype(ov::cache_hits)::value_type(coreConfig.get_cache_statistics().hits);
+    } else if (name == ov::cache_misses.name()) {
+        return decltype(ov::cache_misses)::value_type(coreConfig.get_cache_statistics().misses);
+    } else if (name == ov::cache_evictions.name()) {
+        return decltype(ov::cache_evictions)::value_type(coreConfig.get_cache_statistics().evictions);
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1539,10 +1549,10 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = create_cache_config(it->second.as<std::string>());
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = create_cache_config(it->second.as<std::string>());
         }
         config.erase(it);
     }
@@ -1560,11 +1570,31 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         _flag_enable_mmap = flag;
         config.erase(it);
     }
+
+    it = config.find(ov::cache_max_size.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        _cacheMaxSize = it->second.as<uint64_t>();
+        for (auto& cacheManager : _cacheManagers) {
+            cacheManager.second->set_max_size(_cacheMaxSize);
+        }
+        config.erase(it);
+    }
+
+    it = config.find(ov::cache_memory_max_size.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        _cacheMemoryMaxSize = it->second.as<uint64_t>();
+        for (auto& cacheManager : _cacheManagers) {
+            cacheManager.second->set_memory_max_size(_cacheMemoryMaxSize);
+        }
+        config.erase(it);
+    }
 }
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = create_cache_config(dir);
 }
 
 std::string ov::CoreImpl::CoreConfig::get_cache_dir() const {
@@ -1576,6 +1606,28 @@ bool ov::CoreImpl::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+uint64_t ov::CoreImpl::CoreConfig::get_cache_max_size() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cacheMaxSize;
+}
+
+uint64_t ov::CoreImpl::CoreConfig::get_cache_memory_max_size() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cacheMemoryMaxSize;
+}
+
+ov::FileStorageCacheManager::Statistics ov::CoreImpl::CoreConfig::get_cache_statistics() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    ov::FileStorageCacheManager::Statistics total;
+    for (const auto& cacheManager : _cacheManagers) {
+        const auto statistics = cacheManager.second->get_statistics();
+        total.hits += statistics.hits;
+        total.misses += statistics.misses;
+        total.evictions += statistics.evictions;
+    }
+    return total;
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config_for_device(
@@ -1584,7 +1636,11 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         auto cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        CacheConfig tempConfig;
+        {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            tempConfig = create_cache_config(cache_dir_val);
+        }
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1602,12 +1658,17 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     }
 }
 
-ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::create_cache_config(const std::string& dir) const {
     std::shared_ptr<ov::ICacheManager> cache_manager = nullptr;
 
     if (!dir.empty()) {
         FileUtils::createDirectoryRecursive(dir);
-        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        // keep the size limits, the memory tier and the statistics for all the configs of the directory
+        auto& dir_cache_manager = _cacheManagers[dir];
+        if (!dir_cache_manager) {
+            dir_cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir, _cacheMaxSize, _cacheMemoryMaxSize);
+        }
+        cache_manager = dir_cache_manager;
     }
 
     return {dir, cache_manager};
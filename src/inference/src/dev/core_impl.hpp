@@ -74,8 +74,6 @@ private:
         struct CacheConfig {
             std::string _cacheDir;
             std::shared_ptr<ov::ICacheManager> _cacheManager;
-
-            static CacheConfig create(const std::string& dir);
         };
 
         /**
@@ -91,14 +89,28 @@ private:
 
         bool get_enable_mmap() const;
 
+        uint64_t get_cache_max_size() const;
+
+        uint64_t get_cache_memory_max_size() const;
+
+        // Returns the usage counters summed over all the cache directories
+        ov::FileStorageCacheManager::Statistics get_cache_statistics() const;
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
 
     private:
+        // Creates cache config for the directory, the same cache manager is used for all the configs of a directory
+        // _cacheConfigMutex must be locked
+        CacheConfig create_cache_config(const std::string& dir) const;
+
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
+        mutable std::map<std::string, std::shared_ptr<ov::FileStorageCacheManager>> _cacheManagers;
+        uint64_t _cacheMaxSize = 0;
+        uint64_t _cacheMemoryMaxSize = 0;
         bool _flag_enable_mmap = true;
     };
 
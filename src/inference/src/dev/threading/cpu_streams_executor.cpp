@@ -4,7 +4,11 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -13,6 +17,7 @@
 
 #include "dev/threading/parallel_custom_arena.hpp"
 #include "dev/threading/thread_affinity.hpp"
+#include "openvino/core/except.hpp"
 #include "openvino/itt.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor_internal.hpp"
@@ -21,6 +26,115 @@
 
 namespace ov {
 namespace threading {
+namespace {
+/**
+ * @brief Multi-producer multi-consumer task queue.
+ * Tasks are passed through a lock-free bounded ring buffer (D. Vyukov's algorithm), the mutex protected overflow
+ * queue is used only if the ring buffer is full. Tasks are not taken from the overflow queue before the ring buffer
+ * is drained, and not put to the ring buffer while the overflow queue is not empty, so the FIFO order is kept.
+ */
+class TaskQueue {
+public:
+    explicit TaskQueue(size_t capacity) : _cells(capacity), _mask(capacity - 1) {
+        OPENVINO_ASSERT(capacity > 1 && (capacity & _mask) == 0, "Task queue capacity must be a power of two");
+        for (size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void push(Task&& task) {
+        if (_overflowSize.load(std::memory_order_acquire) == 0 && try_push(task)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(_overflowMutex);
+        _overflow.push(std::move(task));
+        _overflowSize.fetch_add(1, std::memory_order_release);
+    }
+
+    bool try_pop(Task& task) {
+        if (try_pop_ring(task)) {
+            return true;
+        }
+        if (_overflowSize.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(_overflowMutex);
+        // the ring buffer may have been refilled while the overflow queue was being drained
+        if (_overflow.empty() || try_pop_ring(task)) {
+            return static_cast<bool>(task);
+        }
+        task = std::move(_overflow.front());
+        _overflow.pop();
+        _overflowSize.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> _sequence{0};
+        Task _task;
+    };
+
+    bool try_push(Task& task) {
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop_ring(Task& task) {
+        size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    static constexpr size_t cacheLineSize = 64;
+
+    std::vector<Cell> _cells;
+    const size_t _mask;
+    char _pad0[cacheLineSize];
+    std::atomic<size_t> _enqueuePos{0};
+    char _pad1[cacheLineSize];
+    std::atomic<size_t> _dequeuePos{0};
+    char _pad2[cacheLineSize];
+    std::atomic<size_t> _overflowSize{0};
+    std::mutex _overflowMutex;
+    std::queue<Task> _overflow;
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
@@ -315,6 +429,7 @@ struct CPUStreamsExecutor::Impl {
 
     explicit Impl(const Config& config)
         : _config{config},
+          _stickyQueues(std::max(_config._streams, 0)),
           _streams([this] {
               return std::make_shared<Impl::Stream>(this);
           }) {
@@ -360,32 +475,122 @@ struct CPUStreamsExecutor::Impl {
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    if (!PopTask(task, false) && !WaitTask(task)) {
+                        break;
                     }
+                    Execute(task, *(_streams.local()));
                 }
             });
         }
     }
 
+    // Takes the task of the stream served by the current thread first, then the task from the common queue.
+    // The tasks of other streams are stolen only if they wait longer than _stealTimeout or if stealAny is set.
+    bool PopTask(Task& task, bool stealAny) {
+        if (_stickyTasks.load() > 0) {
+            const auto streamId = _streams.local()->_streamId % _config._streams;
+            if (PopStickyTask(task, streamId, true)) {
+                return true;
+            }
+        }
+        if (_taskQueue.try_pop(task)) {
+            return true;
+        }
+        if (_stickyTasks.load() > 0) {
+            const auto now = std::chrono::steady_clock::now();
+            for (int streamId = 0; streamId < _config._streams; ++streamId) {
+                if (PopStickyTask(task, streamId, stealAny, now)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool PopStickyTask(Task& task,
+                       int streamId,
+                       bool any,
+                       std::chrono::steady_clock::time_point now = std::chrono::steady_clock::time_point{}) {
+        auto& stickyQueue = _stickyQueues[streamId];
+        std::unique_lock<std::mutex> lock(stickyQueue._mutex, std::defer_lock);
+        if (any) {
+            lock.lock();
+        } else if (!lock.try_lock()) {
+            return false;
+        }
+        if (stickyQueue._tasks.empty() || (!any && now - stickyQueue._tasks.front().second < _stealTimeout)) {
+            return false;
+        }
+        task = std::move(stickyQueue._tasks.front().first);
+        stickyQueue._tasks.pop_front();
+        _stickyTasks.fetch_sub(1);
+        return true;
+    }
+
+    // Spins for a while and then parks the thread until a task is available
+    // Returns false if the executor is stopped and there are no tasks left
+    bool WaitTask(Task& task) {
+        for (int spin = 0; spin < _spinCount; ++spin) {
+            std::this_thread::yield();
+            if (PopTask(task, false)) {
+                return true;
+            }
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _sleepers.fetch_add(1);
+        // pairs with the fence in Enqueue: either the producer sees the sleeper or the sleeper sees the task
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool found = false;
+        for (;;) {
+            // the stopped executor runs all the remaining tasks regardless of the preferred streams
+            const bool stopped = _isStopped.load();
+            if (PopTask(task, stopped)) {
+                found = true;
+                break;
+            }
+            if (stopped) {
+                break;
+            }
+            if (_stickyTasks.load() > 0) {
+                // wake up to steal the task if its stream stays busy
+                _queueCondVar.wait_for(lock, _stealTimeout);
+            } else {
+                _queueCondVar.wait(lock);
+            }
+        }
+        _sleepers.fetch_sub(1);
+        return found;
+    }
+
     void Enqueue(Task task) {
+        _taskQueue.push(std::move(task));
+        Notify(false);
+    }
+
+    void EnqueueSticky(Task task, int streamId) {
+        auto& stickyQueue = _stickyQueues[streamId % _config._streams];
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            std::lock_guard<std::mutex> lock(stickyQueue._mutex);
+            stickyQueue._tasks.emplace_back(std::move(task), std::chrono::steady_clock::now());
+            _stickyTasks.fetch_add(1);
+        }
+        // the thread of the preferred stream can't be woken up selectively
+        Notify(true);
+    }
+
+    void Notify(bool all) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleepers.load(std::memory_order_relaxed) > 0) {
+            // the sleeper holds the mutex until it waits on the condition variable, so the notification is not lost
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            if (all) {
+                _queueCondVar.notify_all();
+            } else {
+                _queueCondVar.notify_one();
+            }
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -424,8 +629,18 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    TaskQueue _taskQueue{1024};
+    std::atomic<int> _sleepers{0};
+    static constexpr int _spinCount = 64;
+    std::atomic<bool> _isStopped{false};
+    // the tasks waiting for the particular streams, see run_on_stream
+    struct StickyQueue {
+        std::mutex _mutex;
+        std::deque<std::pair<Task, std::chrono::steady_clock::time_point>> _tasks;
+    };
+    std::vector<StickyQueue> _stickyQueues;
+    std::atomic<int> _stickyTasks{0};
+    static constexpr std::chrono::microseconds _stealTimeout{500};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -440,6 +655,8 @@ struct CPUStreamsExecutor::Impl {
     std::shared_ptr<ExecutorManager> _exectorMgr;
 };
 
+constexpr std::chrono::microseconds CPUStreamsExecutor::Impl::_stealTimeout;
+
 int CPUStreamsExecutor::get_stream_id() {
     auto stream = _impl->_streams.local();
     return stream->_streamId;
@@ -482,5 +699,15 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_on_stream(Task task, int stream_id) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else if (stream_id < 0) {
+        _impl->Enqueue(std::move(task));
+    } else {
+        _impl->EnqueueSticky(std::move(task), stream_id);
+    }
+}
+
 }  // namespace threading
 }  // namespace ov
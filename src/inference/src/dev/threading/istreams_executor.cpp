@@ -23,6 +23,10 @@ OPENVINO_SUPPRESS_DEPRECATED_START
 
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run_on_stream(Task task, int) {
+    run(std::move(task));
+}
+
 void IStreamsExecutor::Config::set_property(const std::string& key, const ov::Any& value) {
     set_property({{key, value}});
 }
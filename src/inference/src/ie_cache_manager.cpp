@@ -0,0 +1,337 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include "openvino/util/file_util.hpp"
+
+#ifdef _WIN32
+#    define stat _stat
+#endif
+
+namespace ov {
+
+namespace {
+
+const std::string blobExtension = ".blob";
+
+/**
+ * @brief Input stream over the memory tier entry, the entry data is not copied
+ */
+class SharedStringStream final : public std::istream {
+    class Buffer final : public std::streambuf {
+    public:
+        explicit Buffer(const std::string& data) {
+            char* begin = const_cast<char*>(data.data());
+            setg(begin, begin, begin + data.size());
+        }
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+            if (!(which & std::ios_base::in))
+                return pos_type(off_type(-1));
+            char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+            if (off < eback() - base || off > egptr() - base)
+                return pos_type(off_type(-1));
+            setg(eback(), base + off, egptr());
+            return pos_type(gptr() - eback());
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+            return seekoff(off_type(pos), std::ios_base::beg, which);
+        }
+    };
+
+public:
+    explicit SharedStringStream(std::shared_ptr<const std::string> data)
+        : std::istream(nullptr),
+          m_data(std::move(data)),
+          m_buffer(*m_data) {
+        rdbuf(&m_buffer);
+    }
+
+private:
+    std::shared_ptr<const std::string> m_data;
+    Buffer m_buffer;
+};
+
+bool read_file(const std::string& fileName, std::string& data) {
+    std::ifstream stream(fileName, std::ios_base::binary | std::ios_base::ate);
+    if (!stream)
+        return false;
+    const auto size = stream.tellg();
+    if (size < 0)
+        return false;
+    data.resize(static_cast<size_t>(size));
+    stream.seekg(0);
+    return static_cast<bool>(stream.read(&data[0], data.size()));
+}
+
+}  // namespace
+
+FileStorageCacheManager::FileStorageCacheManager(std::string cachePath, uint64_t maxSize, uint64_t memoryMaxSize)
+    : m_cachePath(std::move(cachePath)),
+      m_maxSize(maxSize),
+      m_memoryMaxSize(memoryMaxSize) {}
+
+void FileStorageCacheManager::set_max_size(uint64_t maxSize) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxSize = maxSize;
+    evict_disk_entries();
+}
+
+void FileStorageCacheManager::set_memory_max_size(uint64_t memoryMaxSize) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryMaxSize = memoryMaxSize;
+    evict_memory_entries();
+}
+
+FileStorageCacheManager::Statistics FileStorageCacheManager::get_statistics() const {
+    Statistics statistics;
+    statistics.hits = m_hits.load();
+    statistics.misses = m_misses.load();
+    statistics.evictions = m_evictions.load();
+    return statistics;
+}
+
+void FileStorageCacheManager::write_cache_entry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    // the entry is written to a unique temporary file first, so the concurrent writers and readers
+    // (including other processes) never see a partially written entry
+    const auto tmpFileName = blobFileName + "." + std::to_string(std::random_device{}()) + ".tmp";
+
+    bool keepInMemory = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        keepInMemory = m_memoryMaxSize > 0;
+    }
+
+    std::shared_ptr<std::string> data;
+    bool written = false;
+    try {
+        std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+        if (keepInMemory) {
+            std::stringstream memoryStream;
+            writer(memoryStream);
+            data = std::make_shared<std::string>(memoryStream.str());
+            stream.write(data->data(), data->size());
+        } else {
+            writer(stream);
+        }
+        stream.close();
+        written = !stream.fail();
+    } catch (...) {
+        std::remove(tmpFileName.c_str());
+        throw;
+    }
+
+#ifdef _WIN32
+    // rename doesn't replace the existing file on Windows
+    if (written)
+        std::remove(blobFileName.c_str());
+#endif
+    if (!written || std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+        std::remove(tmpFileName.c_str());
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_maxSize > 0) {
+        scan_cache_dir();
+        touch_disk_entry(id, data ? data->size() : static_cast<uint64_t>(FileUtils::fileSize(blobFileName)));
+        evict_disk_entries();
+    }
+    // the entry may be evicted immediately if it alone exceeds the cache size limit
+    const bool stored = m_maxSize == 0 || m_diskEntries.count(id) > 0;
+    if (stored && data && data->size() <= m_memoryMaxSize) {
+        put_memory_entry(id, std::move(data));
+    } else {
+        remove_memory_entry(id);
+    }
+}
+
+void FileStorageCacheManager::read_cache_entry(const std::string& id, StreamReader reader) {
+    std::shared_ptr<const std::string> data;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_memoryEntries.find(id);
+        if (found != m_memoryEntries.end()) {
+            data = found->second.data;
+            m_memoryLru.splice(m_memoryLru.begin(), m_memoryLru, found->second.lruIt);
+            auto foundOnDisk = m_diskEntries.find(id);
+            if (foundOnDisk != m_diskEntries.end())
+                m_diskLru.splice(m_diskLru.begin(), m_diskLru, foundOnDisk->second.lruIt);
+        }
+    }
+    if (data) {
+        m_hits++;
+        SharedStringStream stream(std::move(data));
+        reader(stream);
+        return;
+    }
+
+    const auto blobFileName = getBlobFile(id);
+    const auto fileSize = FileUtils::fileSize(blobFileName);
+    if (fileSize < 0) {
+        m_misses++;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        remove_disk_entry(id);
+        return;
+    }
+    m_hits++;
+
+    bool keepInMemory = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_maxSize > 0) {
+            scan_cache_dir();
+            touch_disk_entry(id, static_cast<uint64_t>(fileSize));
+        }
+        keepInMemory = m_memoryMaxSize > 0 && static_cast<uint64_t>(fileSize) <= m_memoryMaxSize;
+    }
+
+    if (keepInMemory) {
+        auto fileData = std::make_shared<std::string>();
+        if (read_file(blobFileName, *fileData)) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                put_memory_entry(id, fileData);
+            }
+            SharedStringStream stream(std::move(fileData));
+            reader(stream);
+            return;
+        }
+    }
+
+    // Map the blob, so plugins can share its content (e.g. weights) instead of copying it
+    std::shared_ptr<ov::MappedMemory> memory;
+    try {
+        memory = ov::load_mmap_object(blobFileName);
+    } catch (const std::runtime_error&) {
+        // fallback to the regular file stream
+    }
+    if (memory) {
+        ov::MmapStream stream(blobFileName, std::move(memory));
+        reader(stream);
+    } else {
+        std::ifstream stream(blobFileName, std::ios_base::binary);
+        reader(stream);
+    }
+}
+
+void FileStorageCacheManager::remove_cache_entry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    remove_disk_entry(id);
+    remove_memory_entry(id);
+}
+
+void FileStorageCacheManager::scan_cache_dir() {
+    if (m_diskIndexed)
+        return;
+    m_diskIndexed = true;
+
+    // the entries written by the previous runs are ordered by the modification time
+    std::vector<std::tuple<time_t, std::string, uint64_t>> entries;
+    try {
+        ov::util::iterate_files(
+            m_cachePath,
+            [&](const std::string& file, bool is_dir) {
+                const auto fileName = ov::util::get_file_name(file);
+                if (is_dir || fileName.size() <= blobExtension.size() ||
+                    fileName.compare(fileName.size() - blobExtension.size(), blobExtension.size(), blobExtension) != 0)
+                    return;
+                struct stat fileInfo;
+                if (stat(file.c_str(), &fileInfo) == 0) {
+                    entries.emplace_back(fileInfo.st_mtime,
+                                         fileName.substr(0, fileName.size() - blobExtension.size()),
+                                         static_cast<uint64_t>(fileInfo.st_size));
+                }
+            },
+            false,
+            false);
+    } catch (const std::runtime_error&) {
+        // the cache directory can't be enumerated, only the entries of this process are tracked
+    }
+    std::sort(entries.begin(), entries.end());
+
+    for (const auto& entry : entries) {
+        touch_disk_entry(std::get<1>(entry), std::get<2>(entry));
+    }
+}
+
+void FileStorageCacheManager::touch_disk_entry(const std::string& id, uint64_t size) {
+    auto found = m_diskEntries.find(id);
+    if (found != m_diskEntries.end()) {
+        m_diskSize = m_diskSize - found->second.size + size;
+        found->second.size = size;
+        m_diskLru.splice(m_diskLru.begin(), m_diskLru, found->second.lruIt);
+    } else {
+        m_diskLru.push_front(id);
+        m_diskEntries[id] = {size, m_diskLru.begin()};
+        m_diskSize += size;
+    }
+}
+
+void FileStorageCacheManager::remove_disk_entry(const std::string& id) {
+    auto found = m_diskEntries.find(id);
+    if (found == m_diskEntries.end())
+        return;
+    m_diskSize -= found->second.size;
+    m_diskLru.erase(found->second.lruIt);
+    m_diskEntries.erase(found);
+}
+
+void FileStorageCacheManager::evict_disk_entries() {
+    if (m_maxSize == 0)
+        return;
+    scan_cache_dir();
+    while (m_diskSize > m_maxSize && !m_diskLru.empty()) {
+        const auto id = m_diskLru.back();
+        std::remove(getBlobFile(id).c_str());
+        remove_disk_entry(id);
+        remove_memory_entry(id);
+        m_evictions++;
+    }
+}
+
+void FileStorageCacheManager::put_memory_entry(const std::string& id, std::shared_ptr<const std::string> data) {
+    remove_memory_entry(id);
+    m_memoryLru.push_front(id);
+    m_memorySize += data->size();
+    m_memoryEntries[id] = {std::move(data), m_memoryLru.begin()};
+    evict_memory_entries();
+}
+
+void FileStorageCacheManager::remove_memory_entry(const std::string& id) {
+    auto found = m_memoryEntries.find(id);
+    if (found == m_memoryEntries.end())
+        return;
+    m_memorySize -= found->second.data->size();
+    m_memoryLru.erase(found->second.lruIt);
+    m_memoryEntries.erase(found);
+}
+
+void FileStorageCacheManager::evict_memory_entries() {
+    while (m_memorySize > m_memoryMaxSize && !m_memoryLru.empty()) {
+        const auto id = m_memoryLru.back();
+        remove_memory_entry(id);
+    }
+}
+
+}  // namespace ov
@@ -9,13 +9,18 @@
  */
 #pragma once
 
+#include <atomic>
 #include <fstream>
 #include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 
@@ -76,21 +81,30 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * Entries are written to a temporary file which is renamed afterwards, so a reader never sees a partially
+ * written entry. Optionally the total size of the entries is limited and the least recently used ones are evicted,
+ * and the recently used entries are kept in an in-process memory tier to skip the disk I/O.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
-    std::string m_cachePath;
-
-    std::string getBlobFile(const std::string& blobHash) const {
-        return FileUtils::makePath(m_cachePath, blobHash + ".blob");
-    }
-
 public:
+    /**
+     * @brief Cache usage counters
+     */
+    struct Statistics {
+        uint64_t hits = 0;       //!< Number of entries found in the cache
+        uint64_t misses = 0;     //!< Number of entries not found in the cache
+        uint64_t evictions = 0;  //!< Number of entries removed from the cache directory to fit the size limit
+    };
+
     /**
      * @brief Constructor
      *
+     * @param cachePath Cache directory
+     * @param maxSize Limit of the cache directory entries size in bytes, zero means no limit
+     * @param memoryMaxSize Limit of the memory tier size in bytes, zero disables the memory tier
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, uint64_t maxSize = 0, uint64_t memoryMaxSize = 0);
 
     /**
      * @brief Destructor
@@ -98,25 +112,69 @@ public:
      */
     ~FileStorageCacheManager() override = default;
 
+    /**
+     * @brief Sets the limit of the cache directory entries size, the exceeding entries are evicted immediately
+     * @param maxSize Limit in bytes, zero means no limit
+     */
+    void set_max_size(uint64_t maxSize);
+
+    /**
+     * @brief Sets the limit of the memory tier size, the exceeding entries are dropped immediately
+     * @param memoryMaxSize Limit in bytes, zero disables the memory tier
+     */
+    void set_memory_max_size(uint64_t memoryMaxSize);
+
+    Statistics get_statistics() const;
+
 private:
-    void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    struct DiskEntry {
+        uint64_t size;
+        std::list<std::string>::iterator lruIt;
+    };
 
-    void read_cache_entry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    struct MemoryEntry {
+        std::shared_ptr<const std::string> data;
+        std::list<std::string>::iterator lruIt;
+    };
 
-    void remove_cache_entry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
+    std::string getBlobFile(const std::string& blobHash) const {
+        return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
+
+    void write_cache_entry(const std::string& id, StreamWriter writer) override;
+
+    void read_cache_entry(const std::string& id, StreamReader reader) override;
+
+    void remove_cache_entry(const std::string& id) override;
+
+    // the methods below require m_mutex to be locked
+    void scan_cache_dir();
+    void touch_disk_entry(const std::string& id, uint64_t size);
+    void remove_disk_entry(const std::string& id);
+    void evict_disk_entries();
+    void put_memory_entry(const std::string& id, std::shared_ptr<const std::string> data);
+    void remove_memory_entry(const std::string& id);
+    void evict_memory_entries();
+
+    const std::string m_cachePath;
+
+    mutable std::mutex m_mutex;
+    uint64_t m_maxSize = 0;
+    uint64_t m_memoryMaxSize = 0;
+
+    // disk entries index, it is built on demand when the size limit is set
+    bool m_diskIndexed = false;
+    uint64_t m_diskSize = 0;
+    std::list<std::string> m_diskLru;  // the most recently used entries first
+    std::unordered_map<std::string, DiskEntry> m_diskEntries;
+
+    uint64_t m_memorySize = 0;
+    std::list<std::string> m_memoryLru;  // the most recently used entries first
+    std::unordered_map<std::string, MemoryEntry> m_memoryEntries;
+
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_evictions{0};
 };
 
 }  // namespace ov
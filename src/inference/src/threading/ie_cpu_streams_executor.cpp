@@ -55,4 +55,8 @@ void CPUStreamsExecutor::run(Task task) {
     _impl->run(std::move(task));
 }
 
+void CPUStreamsExecutor::run_on_stream(Task task, int stream_id) {
+    _impl->run_on_stream(std::move(task), stream_id);
+}
+
 }  // namespace InferenceEngine
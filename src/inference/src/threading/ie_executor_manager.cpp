@@ -85,6 +85,10 @@ public:
     void Execute(Task task) override {
         m_executor->execute(task);
     }
+
+    void run_on_stream(Task task, int stream_id) override {
+        m_executor->run_on_stream(task, stream_id);
+    }
 };
 
 }  // namespace
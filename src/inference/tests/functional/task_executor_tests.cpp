@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 #include <ie_system_conf.h>
 
+#include <algorithm>
+#include <chrono>
 #include <future>
 #include <ie_parallel.hpp>
 #include <thread>
@@ -126,6 +128,30 @@ TEST_P(TaskExecutorTests, canRunMultipleTasksFromMultipleThreads) {
             thread.join();
 }
 
+TEST_P(TaskExecutorTests, canRunManyShortTasksFromMultipleThreads) {
+    auto taskExecutor = GetParam()();
+    constexpr int THREAD_NUMBER = 8;
+    constexpr int TASKS_PER_THREAD = 10000;
+    std::atomic_int sharedVar = {0};
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_NUMBER; i++) {
+        threads.emplace_back([&] {
+            for (int k = 0; k < TASKS_PER_THREAD; k++) {
+                taskExecutor->run([&] {
+                    if (++sharedVar == THREAD_NUMBER * TASKS_PER_THREAD)
+                        done.set_value();
+                });
+            }
+        });
+    }
+    for (auto&& thread : threads)
+        thread.join();
+    ASSERT_EQ(std::future_status::ready, doneFuture.wait_for(std::chrono::seconds(60)));
+    ASSERT_EQ(THREAD_NUMBER * TASKS_PER_THREAD, sharedVar);
+}
+
 TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     std::mutex mutex_block_emulation;
     std::condition_variable cv_block_emulation;
@@ -280,3 +306,76 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorTests, canRunTasksOnPreferredStreams) {
+    constexpr int STREAMS = 4;
+    constexpr int TASKS_PER_STREAM = 100;
+    std::vector<Future> futures;
+    std::atomic_int sharedVar = {0};
+    {
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor", STREAMS, 1, IStreamsExecutor::ThreadBindingType::NONE});
+        // out of range and negative indices are accepted as well
+        for (int streamId = -1; streamId <= STREAMS; streamId++) {
+            for (int i = 0; i < TASKS_PER_STREAM; i++) {
+                auto p = std::make_shared<std::packaged_task<void()>>([&] {
+                    ++sharedVar;
+                });
+                futures.emplace_back(p->get_future());
+                taskExecutor->run_on_stream(
+                    [p] {
+                        (*p)();
+                    },
+                    streamId);
+            }
+        }
+    }
+    // the tasks are not lost even if the executor is destroyed
+    for (auto&& f : futures)
+        ASSERT_NO_THROW(f.get());
+    ASSERT_EQ((STREAMS + 2) * TASKS_PER_STREAM, sharedVar);
+}
+
+// Micro-benchmark of the task submission latency and throughput of the CPU streams executor,
+// run with --gtest_also_run_disabled_tests
+TEST(CPUStreamsExecutorBenchmark, DISABLED_SubmissionLatencyAndThroughput) {
+    using Clock = std::chrono::steady_clock;
+    constexpr int PRODUCERS = 4;
+    constexpr int TASKS_PER_PRODUCER = 50000;
+    const int maxStreams = std::max(getNumberOfLogicalCPUCores(false), 1);
+    for (int streams = 1; streams <= maxStreams; streams *= 2) {
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{
+            "BenchmarkCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+        std::atomic_int executed = {0};
+        std::vector<std::vector<double>> latencies(PRODUCERS);
+        std::vector<std::thread> producers;
+        const auto start = Clock::now();
+        for (int p = 0; p < PRODUCERS; p++) {
+            producers.emplace_back([&, p] {
+                auto& producerLatencies = latencies[p];
+                producerLatencies.resize(TASKS_PER_PRODUCER);
+                for (int k = 0; k < TASKS_PER_PRODUCER; k++) {
+                    const auto submitted = Clock::now();
+                    auto* latency = &producerLatencies[k];
+                    taskExecutor->run([&executed, submitted, latency] {
+                        *latency = std::chrono::duration<double, std::micro>(Clock::now() - submitted).count();
+                        ++executed;
+                    });
+                }
+            });
+        }
+        for (auto&& producer : producers)
+            producer.join();
+        while (executed < PRODUCERS * TASKS_PER_PRODUCER)
+            std::this_thread::yield();
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+        std::vector<double> all;
+        for (auto&& producerLatencies : latencies)
+            all.insert(all.end(), producerLatencies.begin(), producerLatencies.end());
+        std::sort(all.begin(), all.end());
+        std::cout << "streams: " << streams << " throughput: " << all.size() / elapsed.count() / 1e6
+                  << " Mtasks/s latency median: " << all[all.size() / 2]
+                  << " us p99: " << all[all.size() * 99 / 100] << " us" << std::endl;
+    }
+}
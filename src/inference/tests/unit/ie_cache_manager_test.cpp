@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "ie_cache_manager.hpp"
+
+using namespace ov;
+
+class FileStorageCacheManagerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_cacheDir = CommonTestUtils::generateTestFilePrefix() + "_cache_manager";
+        CommonTestUtils::createDirectory(m_cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    static void write(ICacheManager& cacheManager, const std::string& id, size_t size) {
+        cacheManager.write_cache_entry(id, [&](std::ostream& stream) {
+            stream << std::string(size, id[0]);
+        });
+    }
+
+    static std::string read(ICacheManager& cacheManager, const std::string& id) {
+        std::string content;
+        cacheManager.read_cache_entry(id, [&](std::istream& stream) {
+            stream.seekg(0, std::ios_base::end);
+            content.resize(static_cast<size_t>(stream.tellg()));
+            stream.seekg(0);
+            stream.read(&content[0], content.size());
+        });
+        return content;
+    }
+
+    std::string m_cacheDir;
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteRead) {
+    FileStorageCacheManager cacheManager(m_cacheDir);
+    write(cacheManager, "a", 100);
+
+    EXPECT_EQ(read(cacheManager, "a"), std::string(100, 'a'));
+    EXPECT_EQ(read(cacheManager, "b"), std::string());
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1u);
+    // no temporary files are left
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size(), 0u);
+
+    const auto statistics = cacheManager.get_statistics();
+    EXPECT_EQ(statistics.hits, 1u);
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.evictions, 0u);
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteIsNotStored) {
+    FileStorageCacheManager fileCacheManager(m_cacheDir);
+    ICacheManager& cacheManager = fileCacheManager;
+    EXPECT_ANY_THROW(cacheManager.write_cache_entry("a", [&](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("export failed");
+    }));
+
+    EXPECT_EQ(read(cacheManager, "a"), std::string());
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 0u);
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size(), 0u);
+}
+
+TEST_F(FileStorageCacheManagerTests, LeastRecentlyUsedIsEvicted) {
+    FileStorageCacheManager cacheManager(m_cacheDir, 250);
+    write(cacheManager, "a", 100);
+    write(cacheManager, "b", 100);
+    read(cacheManager, "a");
+    write(cacheManager, "c", 100);
+
+    EXPECT_EQ(read(cacheManager, "a"), std::string(100, 'a'));
+    EXPECT_EQ(read(cacheManager, "b"), std::string());
+    EXPECT_EQ(read(cacheManager, "c"), std::string(100, 'c'));
+    EXPECT_EQ(cacheManager.get_statistics().evictions, 1u);
+}
+
+TEST_F(FileStorageCacheManagerTests, SizeLimitAppliesToExistingEntries) {
+    {
+        FileStorageCacheManager cacheManager(m_cacheDir);
+        write(cacheManager, "a", 100);
+        write(cacheManager, "b", 100);
+    }
+
+    FileStorageCacheManager cacheManager(m_cacheDir);
+    cacheManager.set_max_size(150);
+
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1u);
+    EXPECT_EQ(cacheManager.get_statistics().evictions, 1u);
+}
+
+TEST_F(FileStorageCacheManagerTests, MemoryTierSkipsDisk) {
+    FileStorageCacheManager cacheManager(m_cacheDir, 0, 1000);
+    write(cacheManager, "a", 100);
+    // the entry is served from memory even if the file is gone
+    CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+
+    EXPECT_EQ(read(cacheManager, "a"), std::string(100, 'a'));
+
+    static_cast<ICacheManager&>(cacheManager).remove_cache_entry("a");
+    EXPECT_EQ(read(cacheManager, "a"), std::string());
+}
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <ie_common.h>
 
+#include <random>
 #include <vector>
 
 using Box = MemorySolver::Box;
@@ -294,9 +295,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int64_t off1 = ms.getOffset(static_cast<int>(box1.id));
@@ -339,3 +338,36 @@ TEST(MemSolverTest, BestSolution1) {
         for (int j = i + 1; j < n; j++)
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
+
+TEST(MemSolverTest, RandomBoxesDoNotOverlap) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> start_dist(0, 50);
+    std::uniform_int_distribution<int> length_dist(0, 10);
+    std::uniform_int_distribution<int> size_dist(1, 100);
+
+    for (int iteration = 0; iteration < 20; iteration++) {
+        int n = 0;
+        std::vector<Box> boxes;
+        for (int i = 0; i < 100; i++) {
+            const int start = start_dist(gen);
+            boxes.push_back({start, start + length_dist(gen), size_dist(gen), n++});
+        }
+
+        MemorySolver ms(boxes);
+        const int64_t required = ms.solve();
+        EXPECT_GE(required, ms.maxDepth());
+
+        auto no_overlap = [&](Box box1, Box box2) -> bool {
+            int64_t off1 = ms.getOffset(static_cast<int>(box1.id));
+            int64_t off2 = ms.getOffset(static_cast<int>(box2.id));
+            return box1.finish < box2.start || box1.start > box2.finish || off1 + box1.size <= off2 ||
+                   off1 >= off2 + box2.size;
+        };
+
+        for (int i = 0; i < n; i++) {
+            EXPECT_LE(ms.getOffset(i) + boxes[i].size, required);
+            for (int j = i + 1; j < n; j++)
+                ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+        }
+    }
+}
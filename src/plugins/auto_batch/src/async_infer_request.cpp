@@ -6,6 +6,8 @@
 
 #include "async_infer_request.hpp"
 
+#include "openvino/runtime/threading/immediate_executor.hpp"
+
 namespace ov {
 namespace autobatch_plugin {
 
@@ -23,16 +25,27 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
             std::pair<AsyncInferRequest*, ov::threading::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            workerInferRequest->on_request_arrived();
+            // the task is pushed under the mutex, so the worker either sees it when it computes the timeout or
+            // gets the notification while waiting
+            std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
             workerInferRequest->_tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest->_tasks.size());
-            if (sz == workerInferRequest->_batch_size) {
+            // the first request of the batch wakes the worker as well, to adapt the collection timeout
+            if (sz == workerInferRequest->_batch_size || sz == 1) {
                 workerInferRequest->_cond.notify_one();
             }
         };
         AsyncInferRequest* _this = nullptr;
     };
-    m_pipeline = {{/*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+    m_pipeline = {{/*TaskExecutor*/ std::make_shared<ov::threading::ImmediateExecutor>(), /*task*/ [this] {
+                       // gathering the inputs on the submitting thread (rather than in the worker thread serially
+                       // for the whole batch) parallelizes the copies and overlaps them with the previous batch,
+                       // the non-batched inputs are shared by the batch, so they are copied by the worker thread
+                       this->m_sync_request->copy_batched_inputs_if_needed();
+                   }},
+                  {/*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
                        if (this->m_sync_request->m_exception_ptr)  // if the exception happened in the batch1 fallback
                            std::rethrow_exception(this->m_sync_request->m_exception_ptr);
                        auto batchReq = this->m_sync_request->m_batched_request_wrapper;
@@ -48,18 +61,33 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
 
 std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    switch (m_sync_request->m_batched_request_status) {
+    case SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED:
         return m_sync_request->get_profiling_info();
-    else
+    case SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED:
+        return m_sync_request->m_sub_batch_request->get_profiling_info();
+    default:
         return m_request_without_batch->get_profiling_info();
+    }
 }
 
 std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    switch (m_sync_request->m_batched_request_status) {
+    case SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED:
         return m_sync_request->query_state();
-    else
+    case SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED: {
+        const auto& sub_batch_request = m_sync_request->m_sub_batch_request;
+        auto states = sub_batch_request->query_state();
+        for (auto&& state : states) {
+            if (!state._so)
+                state._so = sub_batch_request._so;
+        }
+        return states;
+    }
+    default:
         return m_request_without_batch->query_state();
+    }
 }
 
 void AsyncInferRequest::infer_thread_unsafe() {
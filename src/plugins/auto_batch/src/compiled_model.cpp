@@ -17,13 +17,15 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::string>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_sub_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_with_sub_batch(compiled_models_with_sub_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
@@ -39,6 +41,40 @@ CompiledModel::~CompiledModel() {
     m_worker_requests.clear();
 }
 
+void CompiledModel::WorkerInferRequest::on_request_arrived() {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    if (_last_arrival != std::chrono::steady_clock::time_point{}) {
+        const double interval = std::chrono::duration<double, std::milli>(now - _last_arrival).count();
+        _arrival_interval = _arrival_interval >= 0 ? 0.875 * _arrival_interval + 0.125 * interval : interval;
+    }
+    _last_arrival = now;
+}
+
+void CompiledModel::WorkerInferRequest::on_batch_started() {
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    _batch_start = std::chrono::steady_clock::now();
+}
+
+void CompiledModel::WorkerInferRequest::on_batch_completed() {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    const double time = std::chrono::duration<double, std::milli>(now - _batch_start).count();
+    _execution_time = _execution_time >= 0 ? 0.875 * _execution_time + 0.125 * time : time;
+}
+
+std::chrono::milliseconds CompiledModel::WorkerInferRequest::get_timeout(int collected, std::uint32_t max_timeout) {
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    // nothing to execute yet (the first arrived request wakes the worker) or no statistics collected yet
+    if (collected == 0 || _arrival_interval < 0)
+        return std::chrono::milliseconds(max_timeout);
+    // wait for the rest of the batch (with a margin for the arrival jitter), but not shorter than the batch
+    // execution, as the requests of the previous batch are usually resubmitted right after its completion
+    const double expected = std::max(2.0 * (_batch_size - collected) * _arrival_interval, _execution_time);
+    return std::chrono::milliseconds(
+        std::max<std::uint32_t>(1, std::min<std::uint32_t>(max_timeout, static_cast<std::uint32_t>(expected + 1))));
+}
+
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
     auto workerRequestPtrAndId = GetWorkerInferRequest();
     auto async_infer_request = std::make_shared<ov::autobatch_plugin::SyncInferRequest>(
@@ -64,11 +100,16 @@ CompiledModel::GetWorkerInferRequest() const {
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
+        for (auto it = m_compiled_models_with_sub_batch.rbegin(); it != m_compiled_models_with_sub_batch.rend(); ++it) {
+            ov::SoPtr<ov::IAsyncInferRequest> sub_batch_request = {it->second->create_infer_request(), it->second._so};
+            workerRequestPtr->_sub_batch_requests.emplace_back(static_cast<int>(it->first), sub_batch_request);
+        }
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
+                workerRequestPtr->on_batch_completed();
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
                     workerRequestPtr->_completion_tasks[c]();
@@ -82,7 +123,9 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    const auto time_out =
+                        workerRequestPtr->get_timeout(static_cast<int>(workerRequestPtr->_tasks.size()), m_time_out);
+                    status = workerRequestPtr->_cond.wait_for(lock, time_out);
                 }
                 if (m_terminate) {
                     break;
@@ -91,23 +134,68 @@ CompiledModel::GetWorkerInferRequest() const {
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
+                        workerRequestPtr->_num_collected += sz;
+                        workerRequestPtr->_num_collections++;
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            // the batched inputs were already copied (if needed) when the request was submitted,
+                            // the batched request is idle now, so the shared non-batched inputs can be copied
+                            t.first->m_sync_request->copy_non_batched_inputs_if_needed();
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->on_batch_started();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
+                        workerRequestPtr->_num_collected += sz;
+                        workerRequestPtr->_num_collections++;
+                        // timeout to collect the batch is over, have to execute the requests in the smaller batch
+                        // (if any fits) and the rest in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
+                        int n = 0;
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
+                            sub_batch_tasks;
+                        for (auto& sub_batch : workerRequestPtr->_sub_batch_requests) {
+                            if (sub_batch.first > sz)
+                                continue;
+                            auto& sub_batch_request = sub_batch.second;
+                            for (; n < sub_batch.first; n++) {
+                                OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                                t.first->m_sync_request->m_batched_request_status =
+                                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED;
+                                t.first->m_sync_request->m_sub_batch_request = sub_batch_request;
+                                t.first->m_sync_request->copy_inputs_to_batched_request(sub_batch_request, n);
+                                sub_batch_tasks.push_back(t);
+                            }
+                            sub_batch_request->set_callback(
+                                [&sub_batch_tasks, &sub_batch_request, sz, &arrived, &all_completed](
+                                    std::exception_ptr p) {
+                                    // the tasks are not accessed after the last one completes (and the worker
+                                    // proceeds), so the size is read upfront
+                                    const size_t num = sub_batch_tasks.size();
+                                    for (size_t b = 0; b < num; b++) {
+                                        auto& sync_request = sub_batch_tasks[b].first->m_sync_request;
+                                        if (p)
+                                            sync_request->m_exception_ptr = p;
+                                        else
+                                            sync_request->copy_outputs_from_batched_request(sub_batch_request, b);
+                                        sub_batch_tasks[b].second();
+                                        if (sz == ++arrived) {
+                                            all_completed.set_value();
+                                        }
+                                    }
+                                });
+                            sub_batch_request->start_async();
+                            break;
+                        }
+                        // popping the rest of the tasks collected by the moment of the time-out and execute each
+                        // with batch1
+                        for (; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->m_request_without_batch->set_callback(
                                 [t, sz, &arrived, &all_completed](std::exception_ptr p) {
@@ -204,7 +292,8 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                                             METRIC_KEY(SUPPORTED_METRICS),
                                             ov::model_name.name(),
                                             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                                            ov::execution_devices.name()};
+                                            ov::execution_devices.name(),
+                                            ov::auto_batch_fill_rate.name()};
         } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
             return std::vector<std::string>{ov::auto_batch_timeout.name()};
         } else if (name == ov::execution_devices) {
@@ -218,10 +307,24 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{METRIC_KEY(SUPPORTED_CONFIG_KEYS), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_fill_rate.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_fill_rate) {
+            size_t collected = 0, collections = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+                for (const auto& w : m_worker_requests) {
+                    collected += w->_num_collected;
+                    collections += w->_num_collections;
+                }
+            }
+            float fill_rate = collections ? static_cast<float>(collected) /
+                                                (static_cast<float>(collections) * m_device_info.device_batch_size)
+                                          : 0.f;
+            return fill_rate;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
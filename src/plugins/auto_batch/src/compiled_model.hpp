@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <thread>
 
@@ -30,6 +31,25 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
+        // requests compiled for the smaller batch sizes (in descending order of the batch size),
+        // these execute the partially collected batches instead of the batch-1 fallback
+        std::vector<std::pair<int, ov::SoPtr<ov::IAsyncInferRequest>>> _sub_batch_requests;
+
+        // adaptive timeout: moving averages of the requests arrival interval and of the batch execution time
+        // (in ms, negative until measured)
+        void on_request_arrived();
+        void on_batch_started();
+        void on_batch_completed();
+        std::chrono::milliseconds get_timeout(int collected, std::uint32_t max_timeout);
+        std::mutex _stats_mutex;
+        std::chrono::steady_clock::time_point _last_arrival;
+        std::chrono::steady_clock::time_point _batch_start;
+        double _arrival_interval = -1;
+        double _execution_time = -1;
+
+        // batch fill rate statistics
+        std::atomic_size_t _num_collected = {0};
+        std::atomic_size_t _num_collections = {0};
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -40,7 +60,8 @@ public:
                   const std::set<std::string>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_sub_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -74,6 +95,8 @@ protected:
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    // models compiled for the smaller batch sizes, by the batch size
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_with_sub_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
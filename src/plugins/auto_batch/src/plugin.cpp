@@ -26,7 +26,8 @@ OPENVINO_SUPPRESS_DEPRECATED_START
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  ov::device::priorities.name(),
                                                  ov::auto_batch_timeout.name(),
-                                                 ov::cache_dir.name()};
+                                                 ov::cache_dir.name(),
+                                                 ov::auto_batch_sub_batches.name()};
 OPENVINO_SUPPRESS_DEPRECATED_END
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -133,6 +134,7 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_sub_batches(0));  // no partial batches by default
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -284,52 +286,72 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
-    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
-    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
-        try {
-            auto inputs = reshaped->inputs();
-            std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
-            for (auto& input : inputs) {
-                auto input_shape = input.get_shape();
-                if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input, ov::PartialShape(input_shape)});
+    auto compile_with_batch = [&](uint32_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
+        for (auto& input : inputs) {
+            auto input_shape = input.get_shape();
+            if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
             }
+            partial_shapes.insert({input, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
 
-            reshaped->reshape(partial_shapes);
-
-            OPENVINO_SUPPRESS_DEPRECATED_START
-            for (auto&& input : reshaped->inputs()) {
-                auto& rt_info = input.get_rt_info();
-                auto it = rt_info.find("ie_legacy_td");
-                if (it != rt_info.end()) {
-                    auto td = it->second.as<InferenceEngine::TensorDesc>();
-                    rt_info["ie_legacy_td"] =
-                        InferenceEngine::TensorDesc(td.getPrecision(), input.get_shape(), td.getLayout());
-                }
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        for (auto&& input : reshaped->inputs()) {
+            auto& rt_info = input.get_rt_info();
+            auto it = rt_info.find("ie_legacy_td");
+            if (it != rt_info.end()) {
+                auto td = it->second.as<InferenceEngine::TensorDesc>();
+                rt_info["ie_legacy_td"] =
+                    InferenceEngine::TensorDesc(td.getPrecision(), input.get_shape(), td.getLayout());
             }
-            for (auto&& result : reshaped->get_results()) {
-                auto output = result->input_value(0);
-                auto& rt_info = output.get_rt_info();
-                auto it = rt_info.find("ie_legacy_td");
-                if (it != rt_info.end()) {
-                    auto td = it->second.as<InferenceEngine::TensorDesc>();
-                    rt_info["ie_legacy_td"] =
-                        InferenceEngine::TensorDesc(td.getPrecision(), output.get_shape(), td.getLayout());
-                }
+        }
+        for (auto&& result : reshaped->get_results()) {
+            auto output = result->input_value(0);
+            auto& rt_info = output.get_rt_info();
+            auto it = rt_info.find("ie_legacy_td");
+            if (it != rt_info.end()) {
+                auto td = it->second.as<InferenceEngine::TensorDesc>();
+                rt_info["ie_legacy_td"] =
+                    InferenceEngine::TensorDesc(td.getPrecision(), output.get_shape(), td.getLayout());
             }
-            OPENVINO_SUPPRESS_DEPRECATED_END
+        }
+        OPENVINO_SUPPRESS_DEPRECATED_END
 
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
+
+    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
+    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
+        try {
+            compiled_model_with_batch = compile_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
 
+    // the smaller batches (e.g. 16 and 8 for the batch 32) execute the partially collected batches
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> compiled_models_with_sub_batch;
+    const auto sub_batches = full_properties.find(ov::auto_batch_sub_batches.name());
+    const auto sub_batches_num = sub_batches != full_properties.end() ? sub_batches->second.as<uint32_t>() : 0;
+    if (compiled_model_with_batch) {
+        for (uint32_t i = 1; i <= sub_batches_num; i++) {
+            const uint32_t sub_batch_size = meta_device.device_batch_size >> i;
+            if (sub_batch_size < 2)
+                break;
+            try {
+                compiled_models_with_sub_batch[sub_batch_size] = compile_with_batch(sub_batch_size);
+            } catch (const ov::Exception&) {
+                // the partial batches of this size are executed with the smaller batches or in the batch1 mode
+            }
+        }
+    }
+
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
         OPENVINO_SUPPRESS_DEPRECATED_START
@@ -353,7 +375,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_with_sub_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -54,6 +54,8 @@ void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::string
             batched_tensor._so = m_batched_request_wrapper->_infer_request_batched._so;
         res = create_shared_tensor_on_batched_tensor(batched_tensor, name, batched_inputs, m_batch_id, m_batch_size);
         set_tensor(it, res);
+        m_batched_input_slices.push_back(res);
+        m_is_batched_input.push_back(batched_inputs.count(name) != 0);
     }
 
     for (const auto& it : get_outputs()) {
@@ -64,6 +66,7 @@ void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::string
             batched_tensor._so = m_batched_request_wrapper->_infer_request_batched._so;
         res = create_shared_tensor_on_batched_tensor(batched_tensor, name, batched_outputs, m_batch_id, m_batch_size);
         set_tensor(it, res);
+        m_batched_output_slices.push_back(res);
     }
 }
 
@@ -89,40 +92,65 @@ void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferR
 }
 
 void SyncInferRequest::copy_inputs_if_needed() {
-    for (const auto& it : get_inputs()) {
-        // this request is already in BUSY state, so using the internal functions safely
-        auto dst_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(it);
-        copy_tensor_if_needed(get_tensor(it), dst_tensor, true);
+    copy_batched_inputs_if_needed();
+    copy_non_batched_inputs_if_needed();
+}
+
+void SyncInferRequest::copy_batched_inputs_if_needed() {
+    const auto& inputs = get_inputs();
+    for (size_t i = 0; i < inputs.size(); i++) {
+        // the slice of the batched tensor is used by this request only, so it is safe to fill it
+        // while the batched request executes the other requests (or is idle)
+        if (m_is_batched_input[i])
+            copy_tensor_if_needed(get_tensor(inputs[i]), m_batched_input_slices[i]);
     }
 }
 
-void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
-                                             ov::SoPtr<ov::ITensor>& dst,
-                                             const bool bInput) {
-    auto ptrDst = static_cast<char*>(dst->data());
-    auto ptrSrc = static_cast<char*>(src->data());
-    ptrdiff_t szDst = dst->get_byte_size();
-    ptrdiff_t szSrc = src->get_byte_size();
-    if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szDst / m_batch_size : 0;
-        if ((ptrDst + offset) == ptrSrc)
-            return;
-        else
-            memcpy(ptrDst + offset, ptrSrc, szSrc);
-    } else {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
-        if ((ptrSrc + offset) == ptrDst)
-            return;
-        else
-            memcpy(ptrDst, ptrSrc + offset, szDst);
+void SyncInferRequest::copy_non_batched_inputs_if_needed() {
+    const auto& inputs = get_inputs();
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!m_is_batched_input[i])
+            copy_tensor_if_needed(get_tensor(inputs[i]), m_batched_input_slices[i]);
     }
 }
 
+void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, const ov::SoPtr<ov::ITensor>& dst) {
+    auto ptrDst = dst->data();
+    auto ptrSrc = src->data();
+    // the tensor is a view into the batched tensor already (the default unless the user set own tensor)
+    if (ptrDst == ptrSrc)
+        return;
+    OPENVINO_ASSERT(src->get_byte_size() == dst->get_byte_size(),
+                    "The tensor size doesn't match the size of the batched tensor slice!");
+    memcpy(ptrDst, ptrSrc, dst->get_byte_size());
+}
+
 void SyncInferRequest::copy_outputs_if_needed() {
+    const auto& outputs = get_outputs();
+    for (size_t i = 0; i < outputs.size(); i++) {
+        copy_tensor_if_needed(m_batched_output_slices[i], get_tensor(outputs[i]));
+    }
+}
+
+void SyncInferRequest::copy_inputs_to_batched_request(const ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id) {
+    for (const auto& it : get_inputs()) {
+        auto src = get_tensor(it);
+        auto dst = req->get_tensor(it);
+        // the tensors without the batch dim are the same for all the requests in the batch
+        const auto size = src->get_byte_size();
+        const auto offset = dst->get_byte_size() != size ? batch_id * size : 0;
+        memcpy(static_cast<char*>(dst->data()) + offset, src->data(), size);
+    }
+}
+
+void SyncInferRequest::copy_outputs_from_batched_request(const ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                                         size_t batch_id) {
     for (const auto& it : get_outputs()) {
-        // this request is already in BUSY state, so using the internal functions safely
-        auto dst_tensor = get_tensor(it);
-        copy_tensor_if_needed(m_batched_request_wrapper->_infer_request_batched->get_tensor(it), dst_tensor, false);
+        auto src = req->get_tensor(it);
+        auto dst = get_tensor(it);
+        const auto size = dst->get_byte_size();
+        const auto offset = src->get_byte_size() != size ? batch_id * size : 0;
+        memcpy(dst->data(), static_cast<const char*>(src->data()) + offset, size);
     }
 }
 
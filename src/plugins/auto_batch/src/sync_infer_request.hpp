@@ -23,10 +23,24 @@ public:
     // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
     void set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferRequest>& req);
 
+    // copies the user-set input tensors into the batched tensors
     void copy_inputs_if_needed();
 
+    // copies the user-set inputs which are batched into this request's slices of the batched tensors,
+    // the slices are not used by the batches of the other requests, so it can run while the batched request is busy
+    void copy_batched_inputs_if_needed();
+
+    // copies the user-set inputs which are not batched, such a tensor is shared by all the requests of the batch,
+    // so it must run only while the batched request is idle
+    void copy_non_batched_inputs_if_needed();
+
     void copy_outputs_if_needed();
 
+    // copies the tensors to/from the batch_id slice of the request compiled for another (smaller) batch size
+    void copy_inputs_to_batched_request(const ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id);
+
+    void copy_outputs_from_batched_request(const ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,11 +54,15 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        SUB_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
+    // the request compiled for the smaller batch size which executed this request (SUB_BATCH_EXECUTED)
+    ov::SoPtr<ov::IAsyncInferRequest> m_sub_batch_request;
+
 protected:
-    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
+    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, const ov::SoPtr<ov::ITensor>& dst);
 
     void share_tensors_with_batched_req(const std::set<std::string>& batched_inputs,
                                         const std::set<std::string>& batched_outputs);
@@ -52,6 +70,12 @@ protected:
     size_t m_batch_id;
 
     size_t m_batch_size;
+
+    // views into this request's slices of the batched request tensors (in the order of inputs/outputs)
+    std::vector<ov::SoPtr<ov::ITensor>> m_batched_input_slices;
+    // whether the input is batched, otherwise its "slice" is the whole batched tensor shared by the batch
+    std::vector<bool> m_is_batched_input;
+    std::vector<ov::SoPtr<ov::ITensor>> m_batched_output_slices;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
\ No newline at end of file
@@ -211,8 +211,8 @@ public:
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            t.first->m_sync_request->copy_non_batched_inputs_if_needed();
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
@@ -302,6 +302,38 @@ TEST_P(AutoBatchAsyncInferRequestTest, AutoBatchAsyncInferRequestStartAsyncTest)
     }
 }
 
+TEST_P(AutoBatchAsyncInferRequestTest, AutoBatchSubBatchExecutedRequestReportsSubBatchProfilingTest) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    auto asyncInferRequest = std::make_shared<AsyncInferRequest>(req, m_async_infer_request_without_batch, nullptr);
+    m_auto_batch_async_infer_requests.emplace_back(asyncInferRequest);
+
+    auto sync_sub_batch_request = std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_without_batch);
+    auto async_sub_batch_request =
+        std::make_shared<NiceMock<MockIAsyncInferRequest>>(sync_sub_batch_request, m_executor, nullptr);
+    ov::ProfilingInfo sub_batch_info;
+    sub_batch_info.node_name = "sub_batch";
+    ON_CALL(*sync_sub_batch_request, get_profiling_info())
+        .WillByDefault(Return(std::vector<ov::ProfilingInfo>{sub_batch_info}));
+    EXPECT_CALL(*m_sync_infer_request_without_batch, get_profiling_info()).Times(0);
+
+    // emulates the worker executing the request as a part of the smaller batch
+    req->m_sub_batch_request = {async_sub_batch_request, {}};
+    req->m_batched_request_status = SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED;
+
+    std::vector<ov::ProfilingInfo> info;
+    ASSERT_NO_THROW(info = asyncInferRequest->get_profiling_info());
+    ASSERT_EQ(info.size(), 1u);
+    EXPECT_EQ(info[0].node_name, "sub_batch");
+}
+
 std::vector<ov::element::Type_t> element_type_param{ov::element::Type_t::f16,
                                                     ov::element::Type_t::f32,
                                                     ov::element::Type_t::f64,
@@ -321,4 +353,26 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
                          ::testing::Combine(::testing::ValuesIn(batch_size_param),
                                             ::testing::ValuesIn(element_type_param),
                                             ::testing::ValuesIn(infer_interval_timeout_param)),
-                         AutoBatchAsyncInferRequestTest::getTestCaseName);
\ No newline at end of file
+                         AutoBatchAsyncInferRequestTest::getTestCaseName);
+
+TEST(AutoBatchWorkerTimeoutTest, AdaptiveTimeoutIsBoundedByTheConfiguredOne) {
+    CompiledModel::WorkerInferRequest worker;
+    worker._batch_size = 8;
+    // no statistics yet, so the configured timeout is used
+    EXPECT_EQ(worker.get_timeout(1, 100), std::chrono::milliseconds(100));
+
+    // the requests arrive densely, so the rest of the batch is expected shortly
+    for (int i = 0; i < 8; i++)
+        worker.on_request_arrived();
+    EXPECT_LT(worker.get_timeout(1, 100), std::chrono::milliseconds(100));
+    EXPECT_GE(worker.get_timeout(1, 100), std::chrono::milliseconds(1));
+    // nothing is collected, so there is nothing to execute on the timeout
+    EXPECT_EQ(worker.get_timeout(0, 100), std::chrono::milliseconds(100));
+
+    // the batch execution is longer than the configured timeout
+    worker.on_batch_started();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    worker.on_batch_completed();
+    EXPECT_EQ(worker.get_timeout(1, 10), std::chrono::milliseconds(10));
+    EXPECT_GE(worker.get_timeout(1, 100), std::chrono::milliseconds(20));
+}
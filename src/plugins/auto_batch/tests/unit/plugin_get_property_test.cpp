@@ -25,7 +25,8 @@ using get_property_params = std::tuple<std::string,  // Get Property Name
                                        bool>;        // Throw exception
 
 const char supported_metric[] = "SUPPORTED_METRICS FULL_DEVICE_NAME SUPPORTED_CONFIG_KEYS";
-const char supported_config_keys[] = "AUTO_BATCH_DEVICE_CONFIG MULTI_DEVICE_PRIORITIES AUTO_BATCH_TIMEOUT CACHE_DIR";
+const char supported_config_keys[] =
+    "AUTO_BATCH_DEVICE_CONFIG MULTI_DEVICE_PRIORITIES AUTO_BATCH_TIMEOUT CACHE_DIR AUTO_BATCH_SUB_BATCHES";
 
 class GetPropertyTest : public ::testing::TestWithParam<get_property_params> {
 public:
@@ -88,6 +89,7 @@ TEST_P(GetPropertyTest, GetPropertyTestCase) {
 
 const std::vector<get_property_params> get_property_params_test = {
     get_property_params{"AUTO_BATCH_TIMEOUT", false},
+    get_property_params{"AUTO_BATCH_SUB_BATCHES", false},
     get_property_params{"AUTO_BATCH_DEVICE_CONFIG", true},
     get_property_params{"CACHE_DIR", true},
     get_property_params{METRIC_KEY(SUPPORTED_METRICS), false},
@@ -2,13 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <cstring>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "mock_common.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include "openvino/core/dimension_tracker.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 #include "transformations/utils/utils.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
@@ -205,6 +209,80 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyInputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_inputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyUserInputTensorTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    const auto& input = req->get_inputs()[0];
+    auto batched_tensor = m_sync_infer_request_with_batch->get_tensor(input);
+    // by default the request's tensor is a view into the batched tensor
+    EXPECT_EQ(req->get_tensor(input)->data(), batched_tensor->data());
+
+    auto user_tensor = ov::make_tensor(input.get_element_type(), input.get_shape());
+    std::vector<uint8_t> data(user_tensor->get_byte_size());
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i);
+    std::memcpy(user_tensor->data(), data.data(), data.size());
+    req->set_tensor(input, {user_tensor, nullptr});
+
+    EXPECT_NO_THROW(req->copy_inputs_if_needed());
+    EXPECT_EQ(std::memcmp(batched_tensor->data(), data.data(), data.size()), 0);
+}
+
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyNonBatchedInputWhileBatchIsRunningTestCase) {
+    create_worker(m_batch_size);
+
+    // no batched inputs, so the input tensor is the whole batched tensor shared by all the requests of the batch
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  std::set<std::string>{},
+                                                  m_batched_outputs);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    const auto& input = req->get_inputs()[0];
+    auto batched_tensor = m_sync_infer_request_with_batch->get_tensor(input);
+    const auto byte_size = batched_tensor->get_byte_size();
+    std::vector<uint8_t> running_data(byte_size, 0x5a);
+    std::memcpy(batched_tensor->data(), running_data.data(), byte_size);
+
+    auto user_tensor = ov::make_tensor(input.get_element_type(), input.get_shape());
+    std::vector<uint8_t> data(user_tensor->get_byte_size());
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i);
+    std::memcpy(user_tensor->data(), data.data(), data.size());
+    req->set_tensor(input, {user_tensor, nullptr});
+
+    // the running batch reads the shared tensor while the request is submitted
+    std::atomic<bool> submitted{false};
+    std::atomic<bool> changed{false};
+    std::thread running_batch([&] {
+        while (!submitted) {
+            if (std::memcmp(batched_tensor->data(), running_data.data(), byte_size) != 0)
+                changed = true;
+        }
+    });
+    EXPECT_NO_THROW(req->copy_batched_inputs_if_needed());
+    submitted = true;
+    running_batch.join();
+    EXPECT_FALSE(changed);
+    EXPECT_EQ(std::memcmp(batched_tensor->data(), running_data.data(), byte_size), 0);
+
+    // the worker thread copies the input once the batched request is idle
+    EXPECT_NO_THROW(req->copy_non_batched_inputs_if_needed());
+    EXPECT_EQ(std::memcmp(batched_tensor->data(), data.data(), data.size()), 0);
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
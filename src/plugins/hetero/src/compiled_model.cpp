@@ -7,14 +7,15 @@
 #include <memory>
 
 #include "async_infer_request.hpp"
+#include "cost_model.hpp"
 #include "graph_debug_dump.hpp"
 #include "ie_plugin_config.hpp"
 #include "itt.hpp"
 #include "openvino/op/util/op_types.hpp"
-#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 #include "plugin.hpp"
+#include "properties.hpp"
 #include "xml_parse_utils.h"
 
 template <typename T>
@@ -56,6 +57,7 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
         dumpDotFile = true;
 
     ov::SupportedOpsMap queryNetworkResult;
+    CostModel cost_model;
     auto orderedOps = model->get_ordered_ops();
 
     bool allEmpty = true;
@@ -76,7 +78,14 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
         auto full_properties = m_cfg.get_hetero_properties();
         for (const auto& property : m_cfg.get_device_properties())
             full_properties[property.first] = property.second;
-        queryNetworkResult = plugin->query_model(model, full_properties);
+        auto query_results = get_hetero_plugin()->query_model_per_device(model, full_properties);
+        for (const auto& query_result : query_results)
+            for (const auto& layer_query_result : query_result)
+                queryNetworkResult.emplace(layer_query_result);
+        cost_model = CostModel{query_results};
+        // The affinities by the device priorities are the starting point of the search
+        if (m_cfg.cost_model_partitioning)
+            cost_model.optimize(model, queryNetworkResult);
     }
 
     using Input = ov::Input<ov::Node>;
@@ -115,6 +124,11 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
         }
     }
 
+    // The model is modified by the split, so the partition is estimated before it
+    for (const auto& node : orderedOps)
+        m_partition.emplace(node->get_friendly_name(), affinities[node]);
+    m_partition_cost = cost_model.estimate(model, m_partition);
+
     if (dumpDotFile) {
         ov::hetero::debug::dump_affinities(model, queryNetworkResult, devices);
     }
@@ -234,7 +248,10 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
         for (const auto& v : subgraphIds) {
             map_id.emplace(v.first->get_friendly_name(), v.second);
         }
-        ov::hetero::debug::dump_subgraphs(model, queryNetworkResult, map_id);
+        std::map<std::string, double> node_costs;
+        for (const auto& node : orderedOps)
+            node_costs.emplace(node->get_friendly_name(), cost_model.node_cost(node, affinities[node]));
+        ov::hetero::debug::dump_subgraphs(model, queryNetworkResult, map_id, node_costs, m_partition_cost);
     }
 
     // Break graph using insertion of result parameter split
@@ -411,17 +428,9 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
         // disable caching for subgraphs, because the whole HETERO model is cached
         auto device_config = metaDevices[m_compiled_submodels[id].device];
         device_config[ov::cache_dir.name()] = "";
-        // set exclusive_async_requests in case when model is split
-        if (orderedSubgraphs.size() > 1) {
-            auto supported_internal_properties =
-                plugin->get_core()->get_property(m_compiled_submodels[id].device, ov::internal::supported_properties);
-            if (std::find(supported_internal_properties.begin(),
-                          supported_internal_properties.end(),
-                          ov::internal::exclusive_async_requests) != supported_internal_properties.end()) {
-                // adds property if it is not set yet
-                device_config.insert(ov::internal::exclusive_async_requests(true));
-            }
-        }
+        // exclusive_async_requests is not forced for the split model (but still may be set by the user), so the
+        // subgraphs have own executors and run as a pipeline: while a subgraph executes one infer request,
+        // the previous subgraph can execute the next infer request
         m_compiled_submodels[id].compiled_model = plugin->get_core()->compile_model(m_compiled_submodels[id].model,
                                                                                     m_compiled_submodels[id].device,
                                                                                     device_config);
@@ -518,6 +527,13 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
                                                   GetUInt64Attr(xml_node, "out_node_idx")};
         m_submodels_input_to_prev_output.emplace(in_pair, out_pair);
     }
+    auto partition_node = heteroNode.child("partition");
+    if (!partition_node.empty()) {
+        m_partition_cost = std::stod(GetStrAttr(partition_node, "cost"));
+        FOREACH_CHILD (xml_node, partition_node, "node") {
+            m_partition.emplace(GetStrAttr(xml_node, "name"), GetStrAttr(xml_node, "device"));
+        }
+    }
     set_inputs_and_outputs();
 }
 
@@ -664,7 +680,9 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         std::vector<ov::PropertyName> ro_properties{ov::model_name,
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
-                                                    ov::loaded_from_cache};
+                                                    ov::loaded_from_cache,
+                                                    ov::hetero::partition,
+                                                    ov::hetero::partition_cost};
         return ro_properties;
     };
     const auto& to_string_vector = [](const std::vector<ov::PropertyName>& properties) {
@@ -706,11 +724,11 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{m_loaded_from_cache};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // every subgraph of the pipeline should have enough infer requests in flight to be busy
         unsigned int value = 0u;
         for (const auto& comp_model_desc : m_compiled_submodels) {
-            value = std::max(value,
-                             comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
-                                 .as<unsigned int>());
+            value += comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
+                         .as<unsigned int>();
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
@@ -723,6 +741,10 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
             device_names.push_back(comp_model_desc.device);
         }
         return decltype(ov::execution_devices)::value_type{device_names};
+    } else if (ov::hetero::partition == name) {
+        return decltype(ov::hetero::partition)::value_type{m_partition};
+    } else if (ov::hetero::partition_cost == name) {
+        return decltype(ov::hetero::partition_cost)::value_type{m_partition_cost};
     }
     return m_cfg.get(name);
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -790,6 +812,14 @@ void ov::hetero::CompiledModel::export_model(std::ostream& model_stream) const {
         subnetworkNode.append_attribute("device").set_value(comp_model_desc.device.c_str());
     }
 
+    auto partitionNode = heteroNode.append_child("partition");
+    partitionNode.append_attribute("cost").set_value(std::to_string(m_partition_cost).c_str());
+    for (const auto& it : m_partition) {
+        auto xml_node = partitionNode.append_child("node");
+        xml_node.append_attribute("name").set_value(it.first.c_str());
+        xml_node.append_attribute("device").set_value(it.second.c_str());
+    }
+
     auto heteroConfigsNode = heteroNode.append_child("hetero_config");
     for (const auto& config : m_cfg.get_hetero_properties()) {
         auto heteroConfigNode = heteroConfigsNode.append_child("config");
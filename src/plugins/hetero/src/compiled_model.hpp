@@ -62,6 +62,9 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // device of every node of the original model and the estimated latency of such split
+    std::map<std::string, std::string> m_partition;
+    double m_partition_cost = 0.0;
 };
 }  // namespace hetero
 }  // namespace ov
\ No newline at end of file
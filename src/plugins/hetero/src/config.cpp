@@ -7,10 +7,11 @@
 #include "ie/ie_plugin_config.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero;
 
-Configuration::Configuration() : dump_graph(false) {}
+Configuration::Configuration() : dump_graph(false), cost_model_partitioning(false) {}
 
 Configuration::Configuration(const ov::AnyMap& config, const Configuration& defaultCfg, bool throwOnUnsupported) {
     OPENVINO_SUPPRESS_DEPRECATED_START
@@ -22,6 +23,8 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
 
         if (HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) == key) {
             dump_graph = value.as<bool>();
+        } else if (ov::hetero::cost_model_partitioning == key) {
+            cost_model_partitioning = value.as<bool>();
         } else if ("TARGET_FALLBACK" == key || ov::device::priorities == key) {
             device_priorities = value.as<std::string>();
         } else {
@@ -37,6 +40,8 @@ ov::Any Configuration::get(const std::string& name) const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
         return {dump_graph};
+    } else if (name == ov::hetero::cost_model_partitioning) {
+        return {cost_model_partitioning};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities) {
         return {device_priorities};
     } else {
@@ -48,6 +53,7 @@ ov::Any Configuration::get(const std::string& name) const {
 std::vector<ov::PropertyName> Configuration::get_supported() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     static const std::vector<ov::PropertyName> names = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                        ov::hetero::cost_model_partitioning,
                                                         "TARGET_FALLBACK",
                                                         ov::device::priorities};
     return names;
@@ -57,6 +63,7 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 ov::AnyMap Configuration::get_hetero_properties() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     return {{HETERO_CONFIG_KEY(DUMP_GRAPH_DOT), dump_graph},
+            {ov::hetero::cost_model_partitioning.name(), cost_model_partitioning},
             {"TARGET_FALLBACK", device_priorities},
             {ov::device::priorities.name(), device_priorities}};
     OPENVINO_SUPPRESS_DEPRECATED_END
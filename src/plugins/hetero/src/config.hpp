@@ -32,6 +32,7 @@ struct Configuration {
     ov::AnyMap get_device_properties() const;
 
     bool dump_graph;
+    bool cost_model_partitioning;
     std::string device_priorities;
     ov::AnyMap device_properties;
 };
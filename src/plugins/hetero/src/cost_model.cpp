@@ -0,0 +1,247 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_model.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/util/convolution_base.hpp"
+#include "openvino/op/util/op_types.hpp"
+
+namespace {
+
+// Cost of the tensor byte passed between devices
+constexpr double transfer_cost_per_byte = 1.0;
+// Cost of the launch of a subgraph and its synchronization with the previous one
+constexpr double subgraph_overhead = 1e5;
+
+bool is_compute_node(const ov::Node* node) {
+    return !ov::op::util::is_parameter(node) && !ov::op::util::is_constant(node) && !ov::op::util::is_output(node);
+}
+
+size_t tensor_bytes(const ov::Output<ov::Node>& output) {
+    const auto& shape = output.get_partial_shape();
+    if (shape.is_dynamic())
+        return 0;
+    return (ov::shape_size(shape.to_shape()) * output.get_element_type().bitwidth() + 7) / 8;
+}
+
+/**
+ * @brief Nodes of the model in the topological order with their affinities. Compute nodes connected by the edges
+ * between the nodes with the same affinity form a group, which becomes a single subgraph after the split
+ */
+struct AffinityGraph {
+    AffinityGraph(const std::shared_ptr<const ov::Model>& model, const ov::SupportedOpsMap& affinities)
+        : nodes(model->get_ordered_ops()) {
+        devices.reserve(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            index.emplace(nodes[i].get(), i);
+            auto it = affinities.find(nodes[i]->get_friendly_name());
+            devices.emplace_back(it != affinities.end() ? it->second : std::string{});
+        }
+    }
+
+    void collect_groups() {
+        groups.resize(nodes.size());
+        std::iota(groups.begin(), groups.end(), 0);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (!is_compute_node(nodes[i].get()))
+                continue;
+            for (const auto& input : nodes[i]->inputs()) {
+                const auto producer = index.at(input.get_source_output().get_node());
+                if (is_compute_node(nodes[producer].get()) && devices[producer] == devices[i])
+                    groups[find_group(i)] = find_group(producer);
+            }
+        }
+        for (size_t i = 0; i < nodes.size(); ++i)
+            groups[i] = find_group(i);
+    }
+
+    size_t find_group(size_t i) {
+        while (groups[i] != i) {
+            groups[i] = groups[groups[i]];
+            i = groups[i];
+        }
+        return i;
+    }
+
+    ov::NodeVector nodes;
+    std::vector<std::string> devices;
+    std::vector<size_t> groups;
+    std::unordered_map<const ov::Node*, size_t> index;
+};
+
+}  // namespace
+
+ov::hetero::CostModel::CostModel(const std::vector<ov::SupportedOpsMap>& query_results) {
+    for (const auto& query_result : query_results) {
+        const auto rank = m_device_rank.size();
+        for (const auto& layer_query_result : query_result) {
+            m_device_rank.emplace(layer_query_result.second, rank);
+            m_supported_ops[layer_query_result.second].insert(layer_query_result.first);
+        }
+    }
+}
+
+double ov::hetero::CostModel::device_factor(const std::string& device) const {
+    // Devices with lower priority are assumed to be slower, otherwise the user would put them first
+    auto it = m_device_rank.find(device);
+    return it != m_device_rank.end() ? static_cast<double>(it->second + 1) : 1.0;
+}
+
+bool ov::hetero::CostModel::is_supported(const std::string& node_name, const std::string& device) const {
+    auto it = m_supported_ops.find(device);
+    return it != m_supported_ops.end() && it->second.count(node_name) != 0;
+}
+
+double ov::hetero::CostModel::node_cost(const std::shared_ptr<ov::Node>& node, const std::string& device) const {
+    if (!is_compute_node(node.get()))
+        return 0.0;
+
+    double output_elements = 0.0;
+    for (const auto& output : node->outputs()) {
+        const auto& shape = output.get_partial_shape();
+        output_elements += shape.is_static() ? static_cast<double>(ov::shape_size(shape.to_shape())) : 1.0;
+    }
+
+    // Convolutions and matrix multiplications accumulate a slice of the weights for every output element
+    double work_per_element = 1.0;
+    const auto& out_shape = node->get_output_partial_shape(0);
+    if (node->get_input_size() > 1 && node->get_input_partial_shape(1).is_static() && out_shape.rank().is_static()) {
+        const auto weights_size = static_cast<double>(ov::shape_size(node->get_input_shape(1)));
+        if (ov::is_type<ov::op::util::ConvolutionBase>(node) && out_shape.size() > 1 && out_shape[1].is_static()) {
+            work_per_element = weights_size / std::max<int64_t>(out_shape[1].get_length(), 1);
+        } else if (ov::is_type<ov::op::v0::MatMul>(node) && out_shape.size() > 0 &&
+                   out_shape[out_shape.size() - 1].is_static()) {
+            work_per_element = weights_size / std::max<int64_t>(out_shape[out_shape.size() - 1].get_length(), 1);
+        }
+    }
+
+    return output_elements * std::max(work_per_element, 1.0) * device_factor(device);
+}
+
+double ov::hetero::CostModel::estimate(const std::shared_ptr<const ov::Model>& model,
+                                       const ov::SupportedOpsMap& affinities) const {
+    AffinityGraph graph(model, affinities);
+    graph.collect_groups();
+
+    double cost = 0.0;
+    std::unordered_set<size_t> groups;
+    for (size_t i = 0; i < graph.nodes.size(); ++i) {
+        const auto& node = graph.nodes[i];
+        if (!is_compute_node(node.get()))
+            continue;
+        groups.insert(graph.groups[i]);
+        cost += node_cost(node, graph.devices[i]);
+        // Every output is passed once to every other device which consumes it
+        for (const auto& output : node->outputs()) {
+            std::unordered_set<std::string> consumer_devices;
+            for (const auto& input : output.get_target_inputs()) {
+                const auto consumer = graph.index.at(input.get_node());
+                if (is_compute_node(input.get_node()) && graph.devices[consumer] != graph.devices[i])
+                    consumer_devices.insert(graph.devices[consumer]);
+            }
+            cost += static_cast<double>(tensor_bytes(output) * consumer_devices.size()) * transfer_cost_per_byte;
+        }
+    }
+    return cost + static_cast<double>(groups.size()) * subgraph_overhead;
+}
+
+void ov::hetero::CostModel::optimize(const std::shared_ptr<const ov::Model>& model,
+                                     ov::SupportedOpsMap& affinities) const {
+    AffinityGraph graph(model, affinities);
+
+    // Every move merges the group with at least one neighbour, so the number of groups decreases on every step
+    for (bool moved = true; moved;) {
+        moved = false;
+        graph.collect_groups();
+
+        std::map<size_t, std::vector<size_t>> members;
+        std::map<size_t, double> base_costs;
+        // bytes passed between the neighbouring groups
+        std::map<size_t, std::map<size_t, size_t>> neighbours;
+        for (size_t i = 0; i < graph.nodes.size(); ++i) {
+            const auto& node = graph.nodes[i];
+            if (!is_compute_node(node.get()) || graph.devices[i].empty())
+                continue;
+            const auto group = graph.groups[i];
+            members[group].push_back(i);
+            base_costs[group] += node_cost(node, graph.devices[i]) / device_factor(graph.devices[i]);
+            for (const auto& input : node->inputs()) {
+                const auto producer = graph.index.at(input.get_source_output().get_node());
+                const auto producer_group = graph.groups[producer];
+                if (!is_compute_node(graph.nodes[producer].get()) || graph.devices[producer].empty() ||
+                    producer_group == group)
+                    continue;
+                const auto bytes = tensor_bytes(input.get_source_output());
+                neighbours[group][producer_group] += bytes;
+                neighbours[producer_group][group] += bytes;
+            }
+        }
+
+        // Cheap groups are the first candidates to be merged into their neighbours
+        std::vector<size_t> candidates;
+        for (const auto& group : members)
+            candidates.push_back(group.first);
+        std::stable_sort(candidates.begin(), candidates.end(), [&](size_t lhs, size_t rhs) {
+            return base_costs[lhs] < base_costs[rhs];
+        });
+
+        for (const auto group : candidates) {
+            const auto& device = graph.devices[group];
+            std::map<std::string, double> deltas;
+            for (const auto& neighbour : neighbours[group]) {
+                const auto& neighbour_device = graph.devices[neighbour.first];
+                auto& delta = deltas[neighbour_device];
+                delta -= static_cast<double>(neighbour.second) * transfer_cost_per_byte + subgraph_overhead;
+            }
+
+            std::string best_device;
+            double best_delta = 0.0;
+            for (auto& delta : deltas) {
+                const auto& target = delta.first;
+                const bool all_supported = std::all_of(members[group].begin(), members[group].end(), [&](size_t i) {
+                    return is_supported(graph.nodes[i]->get_friendly_name(), target);
+                });
+                if (!all_supported)
+                    continue;
+                delta.second += base_costs[group] * (device_factor(target) - device_factor(device));
+                if (delta.second < best_delta) {
+                    best_delta = delta.second;
+                    best_device = target;
+                }
+            }
+
+            if (!best_device.empty()) {
+                for (const auto i : members[group])
+                    graph.devices[i] = best_device;
+                moved = true;
+                break;
+            }
+        }
+    }
+
+    // Parameters, constants and results follow the nodes they are connected to, so they don't form own subgraphs
+    for (size_t i = 0; i < graph.nodes.size(); ++i) {
+        const auto& node = graph.nodes[i];
+        if (is_compute_node(node.get()) || graph.devices[i].empty())
+            continue;
+        std::unordered_set<std::string> connected_devices;
+        for (const auto& input : node->inputs())
+            connected_devices.insert(graph.devices[graph.index.at(input.get_source_output().get_node())]);
+        for (const auto& output : node->outputs())
+            for (const auto& input : output.get_target_inputs())
+                connected_devices.insert(graph.devices[graph.index.at(input.get_node())]);
+        if (connected_devices.size() == 1 && is_supported(node->get_friendly_name(), *connected_devices.begin()))
+            graph.devices[i] = *connected_devices.begin();
+    }
+
+    for (size_t i = 0; i < graph.nodes.size(); ++i) {
+        if (!graph.devices[i].empty())
+            affinities[graph.nodes[i]->get_friendly_name()] = graph.devices[i];
+    }
+}
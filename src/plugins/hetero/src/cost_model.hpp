@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/common.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Estimates the latency of the model split between devices and searches for a cheaper split
+ *
+ * The estimated latency (in abstract units, roughly multiply-accumulate operations on the first priority device)
+ * is a sum of:
+ *  - the compute cost of every node, scaled by the rank of its device in the device priorities,
+ *  - the size in bytes of every tensor passed between different devices,
+ *  - the fixed overhead of every subgraph (launch of the subgraph and synchronization with the previous one).
+ */
+class CostModel {
+public:
+    /**
+     * @param query_results Query results of every device in the order of the device priorities
+     */
+    explicit CostModel(const std::vector<ov::SupportedOpsMap>& query_results = {});
+
+    /**
+     * @brief Estimated latency of the model with the given affinities
+     */
+    double estimate(const std::shared_ptr<const ov::Model>& model, const ov::SupportedOpsMap& affinities) const;
+
+    /**
+     * @brief Moves the groups of connected nodes with the same affinity to the device of a neighbouring group
+     * while it lowers the estimated latency. A group is moved only if the device supports all of its nodes.
+     */
+    void optimize(const std::shared_ptr<const ov::Model>& model, ov::SupportedOpsMap& affinities) const;
+
+    /**
+     * @brief Estimated compute cost of the node on the device
+     */
+    double node_cost(const std::shared_ptr<ov::Node>& node, const std::string& device) const;
+
+private:
+    double device_factor(const std::string& device) const;
+
+    bool is_supported(const std::string& node_name, const std::string& device) const;
+
+    std::map<std::string, size_t> m_device_rank;
+    std::map<std::string, std::unordered_set<std::string>> m_supported_ops;
+};
+
+}  // namespace hetero
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #include "graph_debug_dump.hpp"
 
+#include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/visualize_tree.hpp"
 
 namespace ov {
@@ -58,7 +59,9 @@ void dump_affinities(const std::shared_ptr<ov::Model>& model,
 
 void dump_subgraphs(const std::shared_ptr<ov::Model>& model,
                     const std::map<std::string, std::string>& supported_ops_map,
-                    const std::map<std::string, int>& map_id) {
+                    const std::map<std::string, int>& map_id,
+                    const std::map<std::string, double>& node_costs,
+                    double partition_cost) {
     auto name = model->get_friendly_name();
 
     ov::pass::VisualizeTree{
@@ -70,7 +73,12 @@ void dump_subgraphs(const std::shared_ptr<ov::Model>& model,
                 return str.find("label") != std::string::npos;
             });
             auto label = "\\nsubgraph=" + std::to_string(map_id.at(node.get_friendly_name())) + "\\n" +
-                         "device=" + supported_ops_map.at(node.get_friendly_name()) + '\"';
+                         "device=" + supported_ops_map.at(node.get_friendly_name()) + "\\n" +
+                         "cost=" + std::to_string(node_costs.at(node.get_friendly_name()));
+            // the estimated latency of the whole partition is shown on the model outputs
+            if (ov::op::util::is_output(&node))
+                label += "\\npartition cost=" + std::to_string(partition_cost);
+            label += '\"';
             OPENVINO_ASSERT(itLabel != attributes.end());
             itLabel->pop_back();
             (*itLabel) += label;
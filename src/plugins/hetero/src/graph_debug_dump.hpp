@@ -13,7 +13,9 @@ void dump_affinities(const std::shared_ptr<ov::Model>& model,
                      const std::unordered_set<std::string>& devices);
 void dump_subgraphs(const std::shared_ptr<ov::Model>& model,
                     const std::map<std::string, std::string>& supported_ops_map,
-                    const std::map<std::string, int>& map_id);
+                    const std::map<std::string, int>& map_id,
+                    const std::map<std::string, double>& node_costs,
+                    double partition_cost);
 
 }  // namespace debug
 }  // namespace hetero
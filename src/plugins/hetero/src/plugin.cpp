@@ -68,12 +68,9 @@ ov::hetero::Plugin::DeviceProperties ov::hetero::Plugin::get_properties_per_devi
     return device_properties;
 }
 
-ov::SupportedOpsMap ov::hetero::Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
-                                                    const ov::AnyMap& properties) const {
-    OV_ITT_SCOPED_TASK(itt::domains::Hetero, "Plugin::query_model");
-
-    OPENVINO_ASSERT(model, "OpenVINO Model is empty!");
-
+std::vector<ov::SupportedOpsMap> ov::hetero::Plugin::query_model_per_device(
+    const std::shared_ptr<const ov::Model>& model,
+    const ov::AnyMap& properties) const {
     Configuration full_config{properties, m_cfg};
     DeviceProperties properties_per_device =
         get_properties_per_device(full_config.device_priorities, full_config.get_device_properties());
@@ -88,9 +85,22 @@ ov::SupportedOpsMap ov::hetero::Plugin::query_model(const std::shared_ptr<const
     //  WARNING: Here is devices with user set priority
     auto device_names = ov::DeviceIDParser::get_hetero_devices(full_config.device_priorities);
 
-    ov::SupportedOpsMap res;
+    std::vector<ov::SupportedOpsMap> res;
     for (const auto& device_name : device_names)
-        for (const auto& layer_query_result : query_results[device_name])
+        res.emplace_back(query_results[device_name]);
+
+    return res;
+}
+
+ov::SupportedOpsMap ov::hetero::Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
+                                                    const ov::AnyMap& properties) const {
+    OV_ITT_SCOPED_TASK(itt::domains::Hetero, "Plugin::query_model");
+
+    OPENVINO_ASSERT(model, "OpenVINO Model is empty!");
+
+    ov::SupportedOpsMap res;
+    for (const auto& query_result : query_model_per_device(model, properties))
+        for (const auto& layer_query_result : query_result)
             res.emplace(layer_query_result);
 
     return res;
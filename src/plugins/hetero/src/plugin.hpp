@@ -59,6 +59,10 @@ private:
     DeviceProperties get_properties_per_device(const std::string& device_priorities,
                                                const ov::AnyMap& properties) const;
 
+    // Query results of every device in the order of the device priorities
+    std::vector<ov::SupportedOpsMap> query_model_per_device(const std::shared_ptr<const ov::Model>& model,
+                                                            const ov::AnyMap& properties) const;
+
     Configuration m_cfg;
 };
 
@@ -13,5 +13,21 @@ namespace hetero {
  */
 static constexpr Property<std::string, PropertyMutability::RO> caching_device_properties{"CACHING_DEVICE_PROPERTIES"};
 
+/**
+ * @brief Read-write property to enable the partitioning of the model by the estimated latency: the compute cost of
+ * the nodes, the size of the tensors passed between devices and the overhead of every subgraph
+ */
+static constexpr Property<bool, PropertyMutability::RW> cost_model_partitioning{"HETERO_COST_MODEL_PARTITIONING"};
+
+/**
+ * @brief Read-only property to get the device assigned to every node of the compiled model
+ */
+static constexpr Property<std::map<std::string, std::string>, PropertyMutability::RO> partition{"HETERO_PARTITION"};
+
+/**
+ * @brief Read-only property to get the estimated latency of the compiled model partition (in abstract units)
+ */
+static constexpr Property<double, PropertyMutability::RO> partition_cost{"HETERO_PARTITION_COST"};
+
 }  // namespace hetero
 }  // namespace ov
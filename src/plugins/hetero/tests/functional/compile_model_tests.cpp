@@ -55,7 +55,7 @@ TEST_F(HeteroTests, compile_with_device_properties) {
     auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
     ASSERT_TRUE(mock0_properties.count(ov::num_streams.name()));
     ASSERT_TRUE(mock0_properties.count(ov::enable_profiling.name()));
-    EXPECT_EQ(1, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    EXPECT_EQ(4, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
     EXPECT_EQ(false, mock0_properties.at(ov::enable_profiling.name()).as<bool>());
     ASSERT_TRUE(device_properties.count("MOCK1.0"));
     auto mock1_properties = device_properties.at("MOCK1.0").as<ov::AnyMap>();
@@ -84,6 +84,79 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, compile_with_device_properties_exclusive) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::internal::exclusive_async_requests(true),
+                         ov::device::properties("MOCK0", ov::num_streams(4)),
+                         ov::device::properties("MOCK1", ov::num_streams(6))};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, "HETERO", config);
+    auto device_properties = compiled_model.get_property(ov::device::properties.name()).as<ov::AnyMap>();
+    ASSERT_TRUE(device_properties.count("MOCK0.0"));
+    auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
+    EXPECT_EQ(1, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    ASSERT_TRUE(device_properties.count("MOCK1.0"));
+    auto mock1_properties = device_properties.at("MOCK1.0").as<ov::AnyMap>();
+    EXPECT_EQ(1, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+}
+
+TEST_F(HeteroTests, infer_pipelined_requests) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, "HETERO", config);
+
+    // the requests run concurrently, so the subgraphs execute different requests at the same time
+    const size_t num_requests = 4;
+    std::vector<ov::InferRequest> requests;
+    for (size_t r = 0; r < num_requests; r++) {
+        auto request = compiled_model.create_infer_request();
+        auto input = request.get_input_tensor();
+        auto data = input.data<int64_t>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<int64_t>(r * 100 + i);
+        requests.emplace_back(std::move(request));
+    }
+    for (auto& request : requests)
+        request.start_async();
+    for (size_t r = 0; r < num_requests; r++) {
+        requests[r].wait();
+        auto output = requests[r].get_output_tensor();
+        auto data = output.data<int64_t>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            EXPECT_EQ(static_cast<int64_t>(r * 100 + i), data[i]);
+    }
+}
+
+TEST_F(HeteroTests, compile_with_cost_model_partitioning) {
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, "HETERO", ov::device::priorities("MOCK0,MOCK1"));
+    auto partition = compiled_model.get_property("HETERO_PARTITION").as<std::map<std::string, std::string>>();
+    auto cost = compiled_model.get_property("HETERO_PARTITION_COST").as<double>();
+    // add, sub and reshape are split into 3 subgraphs by the device priorities
+    EXPECT_NE(partition.at("add"), partition.at("sub"));
+    EXPECT_NE(partition.at("sub"), partition.at("reshape"));
+
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), {"HETERO_COST_MODEL_PARTITIONING", true}};
+    auto optimized_model = core.compile_model(model, "HETERO", config);
+    auto optimized_partition =
+        optimized_model.get_property("HETERO_PARTITION").as<std::map<std::string, std::string>>();
+    auto optimized_cost = optimized_model.get_property("HETERO_PARTITION_COST").as<double>();
+    // add is moved to the device of sub, so one subgraph less is executed
+    EXPECT_EQ(optimized_partition.at("add"), optimized_partition.at("sub"));
+    EXPECT_NE(optimized_partition.at("sub"), optimized_partition.at("reshape"));
+    EXPECT_LT(optimized_cost, cost);
+
+    auto request = optimized_model.create_infer_request();
+    auto input = request.get_input_tensor();
+    auto data = input.data<int64_t>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        data[i] = static_cast<int64_t>(i);
+    request.infer();
+    auto result = request.get_output_tensor().data<int64_t>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        EXPECT_EQ(static_cast<int64_t>(i), result[i]);
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
@@ -39,6 +39,7 @@ TEST_F(HeteroTests, get_property_supported_metrics) {
 
 TEST_F(HeteroTests, get_property_supported_configs) {
     const std::vector<std::string> supported_configs = {"HETERO_DUMP_GRAPH_DOT",
+                                                        "HETERO_COST_MODEL_PARTITIONING",
                                                         "TARGET_FALLBACK",
                                                         ov::device::priorities.name()};
     auto actual_supported_configs =
@@ -15,3 +15,25 @@ ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInfe
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
     StopAndWait();
 }
+
+namespace {
+class PreferredStreamExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    PreferredStreamExecutor(const InferenceEngine::IStreamsExecutor::Ptr& streamsExecutor, int streamId)
+        : _streamsExecutor(streamsExecutor), _streamId(streamId) {}
+
+    void run(InferenceEngine::Task task) override {
+        _streamsExecutor->run_on_stream(std::move(task), _streamId);
+    }
+
+private:
+    InferenceEngine::IStreamsExecutor::Ptr _streamsExecutor;
+    int _streamId;
+};
+}   // namespace
+
+void ov::intel_cpu::AsyncInferRequest::SetPreferredStream(const InferenceEngine::IStreamsExecutor::Ptr& streamsExecutor,
+                                                          int streamId) {
+    // the only pipeline stage runs the inference
+    _pipeline.front().first = std::make_shared<PreferredStreamExecutor>(streamsExecutor, streamId);
+}
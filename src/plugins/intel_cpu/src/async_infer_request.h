@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <threading/ie_istreams_executor.hpp>
 #include "infer_request.h"
 
 namespace ov {
@@ -18,6 +19,9 @@ public:
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~AsyncInferRequest();
+
+    // runs the inferences of the request preferably in the given stream of the executor
+    void SetPreferredStream(const InferenceEngine::IStreamsExecutor::Ptr& streamsExecutor, int streamId);
 };
 
 }   // namespace intel_cpu
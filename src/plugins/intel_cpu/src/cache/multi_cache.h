@@ -7,6 +7,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,7 +16,7 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is created with the threadSafe flag set!
  */
 
 class MultiCache {
@@ -29,9 +30,16 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe the cache may be accessed concurrently (e.g. shared between the graphs of several streams).
+    *       In this case the values are built out of the lock, so two threads may build the same value simultaneously,
+    *       but only the first built one is stored and returned to both of them.
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity) {
+        if (threadSafe) {
+            _mutex = std::make_shared<std::mutex>();
+        }
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,11 +53,18 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
+        if (_mutex) {
+            return getOrCreateSync<KeyType, BuilderType, ValueType>(key, std::move(builder));
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
 private:
+    template<typename KeyType, typename BuilderType, typename ValueType>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreateSync(const KeyType& key, BuilderType builder);
+
     template<typename T>
     size_t getTypeId();
     template<typename KeyType, typename ValueType>
@@ -59,6 +74,7 @@ private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    std::shared_ptr<std::mutex> _mutex;
 };
 
 template<typename T>
@@ -79,6 +95,34 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     return std::static_pointer_cast<EntryType>(itr->second);
 }
 
+template<typename KeyType, typename BuilderType, typename ValueType>
+typename CacheEntry<KeyType, ValueType>::ResultType
+MultiCache::getOrCreateSync(const KeyType& key, BuilderType builder) {
+    const auto empty = ValueType();
+    EntryPtr<KeyType, ValueType> entry;
+    {
+        std::lock_guard<std::mutex> lock(*_mutex);
+        entry = getEntry<KeyType, ValueType>();
+        auto value = entry->_impl.get(key);
+        if (value != empty) {
+            return {value, CacheEntryBase::LookUpStatus::Hit};
+        }
+    }
+
+    // the builder is called out of the lock, since it may take a while and may access the cache itself
+    auto value = builder(key);
+    if (value != empty) {
+        std::lock_guard<std::mutex> lock(*_mutex);
+        auto stored = entry->_impl.get(key);
+        if (stored != empty) {
+            // the same value has been built by another thread in the meantime
+            return {stored, CacheEntryBase::LookUpStatus::Hit};
+        }
+        entry->_impl.put(key, value);
+    }
+    return {value, CacheEntryBase::LookUpStatus::Miss};
+}
+
 using MultiCacheWeakPtr = std::weak_ptr<MultiCache>;
 using MultiCacheWeakCPtr = std::weak_ptr<const MultiCache>;
 using MultiCachePtr = std::shared_ptr<MultiCache>;
@@ -17,6 +17,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "utils/debug_capabilities.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -129,6 +130,24 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == ov::intel_cpu::shared_streams_cache.name()) {
+            if (val == PluginConfigParams::YES) {
+                sharedStreamsCache = true;
+            } else if (val == PluginConfigParams::NO) {
+                sharedStreamsCache = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::shared_streams_cache.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::sticky_streams.name()) {
+            if (val == PluginConfigParams::YES) {
+                stickyStreams = true;
+            } else if (val == PluginConfigParams::NO) {
+                stickyStreams = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::sticky_streams.name()
+                           << ". Expected only true/false." << std::endl;
+            }
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -66,12 +66,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const RepackedWeights::CPtr &repackedWeights) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _repackedWeights(repackedWeights) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -180,11 +182,25 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     auto weightsCache =
                         (_cfg.streamExecutorConfig._streams != 1 && socketId != -1) ? _socketWeights[socketId] : nullptr;
 
+                    // the streams on the same socket share the primitives and executors created by any of them
+                    MultiCachePtr paramsCache;
+                    if (_cfg.sharedStreamsCache && _cfg.streamExecutorConfig._streams != 1 && socketId != -1) {
+                        auto& socketParamsCache = _socketParamsCaches[socketId];
+                        if (!socketParamsCache)
+                            socketParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
+                        paramsCache = socketParamsCache;
+                    }
+
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         paramsCache,
+                                                         _repackedWeights);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -204,7 +220,14 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
 }
 
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+    auto asyncRequest = CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+    auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(_taskExecutor);
+    if (_cfg.stickyStreams && streamsExecutor && _cfg.streamExecutorConfig._streams > 1) {
+        // spread the requests over the streams (and so over the NUMA nodes) evenly
+        const int streamId = (_nextPreferredStream++) % _cfg.streamExecutorConfig._streams;
+        std::static_pointer_cast<AsyncInferRequest>(asyncRequest)->SetPreferredStream(streamsExecutor, streamId);
+    }
+    return asyncRequest;
 }
 
 std::shared_ptr<ngraph::Function> ExecNetwork::GetExecGraphInfo() {
@@ -303,6 +326,12 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::shared_streams_cache.name()),
+            RO_property(ov::intel_cpu::sticky_streams.name()),
+            RO_property(ov::intel_cpu::shape_cache_hits.name()),
+            RO_property(ov::intel_cpu::shape_cache_misses.name()),
+            RO_property(ov::intel_cpu::memory_workspace_size.name()),
+            RO_property(ov::intel_cpu::memory_fragmentation.name()),
         };
     }
 
@@ -360,6 +389,26 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::shared_streams_cache) {
+        return decltype(ov::intel_cpu::shared_streams_cache)::value_type(config.sharedStreamsCache);
+    } else if (name == ov::intel_cpu::sticky_streams) {
+        return decltype(ov::intel_cpu::sticky_streams)::value_type(config.stickyStreams);
+    } else if (name == ov::intel_cpu::shape_cache_hits || name == ov::intel_cpu::shape_cache_misses) {
+        const bool hits = name == ov::intel_cpu::shape_cache_hits;
+        uint64_t counter = hits ? graph.getShapeCacheHits() : graph.getShapeCacheMisses();
+        for (auto& otherGraph : _graphs) {
+            if (&otherGraph == &graph)
+                continue;
+            GraphGuard::Lock lock(otherGraph);
+            if (otherGraph.IsReady())
+                counter += hits ? otherGraph.getShapeCacheHits() : otherGraph.getShapeCacheMisses();
+        }
+        return decltype(ov::intel_cpu::shape_cache_hits)::value_type(counter);
+    } else if (name == ov::intel_cpu::memory_workspace_size) {
+        // all the streams share the same memory plan
+        return decltype(ov::intel_cpu::memory_workspace_size)::value_type(graph.getWorkspaceSize());
+    } else if (name == ov::intel_cpu::memory_fragmentation) {
+        return decltype(ov::intel_cpu::memory_fragmentation)::value_type(graph.getWorkspaceFragmentation());
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -369,6 +418,9 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    GraphGuard::Lock graphLock{GetGraph()};
+    serializer.writeRepackedWeights(graphLock._graph);
 }
 
 }   // namespace intel_cpu
@@ -37,7 +37,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const RepackedWeights::CPtr &repackedWeights = nullptr);
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -57,6 +58,8 @@ protected:
     mutable std::shared_ptr<std::mutex>         _mutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    // round robin counter of the preferred streams of the infer requests, used only if the streams are sticky
+    std::atomic_int                             _nextPreferredStream = {0};
     std::string                                 _name;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
@@ -69,6 +72,10 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable SocketsWeights                      _socketWeights;
+    // thread safe primitives caches per socket, used only if the streams share them
+    mutable std::map<int, MultiCachePtr>        _socketParamsCaches;
+    // weights repacked by the graph the network was exported from, empty if the network was not imported
+    RepackedWeights::CPtr                       _repackedWeights;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -50,7 +50,9 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "cache/lru_cache.h"
 #include <common/primitive_desc.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #include <common/primitive_desc_iface.hpp>
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #   include <tbb/task.h>
@@ -66,6 +68,61 @@ namespace intel_cpu {
 typedef std::unordered_set<EdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
+/**
+ * @brief Stores the output shapes of the executable nodes of a dynamic graph per set of the graph input shapes (shape signature).
+ * The shape signature also includes the shapes of the states, since they are the graph inputs as well.
+ *
+ * @attention This cache implementation IS NOT THREAD SAFE!
+ */
+class ShapeCache {
+public:
+    // output shapes per executable node, empty for the static nodes
+    using NodesShapes = std::vector<std::vector<VectorDims>>;
+    using NodesShapesCPtr = std::shared_ptr<const NodesShapes>;
+
+    ShapeCache(std::vector<NodePtr> inputNodes, size_t capacity) : m_inputNodes(std::move(inputNodes)), m_cache(capacity) {}
+
+    struct Key {
+        std::vector<VectorDims> dims;
+
+        size_t hash() const {
+            using namespace dnnl::impl;
+            using namespace dnnl::impl::primitive_hashing;
+
+            size_t seed = 0;
+            for (const auto& item : dims) {
+                seed = get_vector_hash(seed, item);
+            }
+            return seed;
+        }
+
+        bool operator==(const Key& rhs) const {
+            return dims == rhs.dims;
+        }
+    };
+
+    Key makeKey() const {
+        Key key;
+        key.dims.reserve(m_inputNodes.size());
+        for (const auto& node : m_inputNodes) {
+            key.dims.push_back(node->getChildEdgeAt(0)->getMemory().getStaticDims());
+        }
+        return key;
+    }
+
+    NodesShapesCPtr get(const Key& key) {
+        return m_cache.get(key);
+    }
+
+    void put(const Key& key, NodesShapesCPtr shapes) {
+        m_cache.put(key, shapes);
+    }
+
+private:
+    std::vector<NodePtr> m_inputNodes;
+    LruCache<Key, NodesShapesCPtr> m_cache;
+};
+
 Graph::~Graph() {
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
 }
@@ -378,6 +435,8 @@ void Graph::InitGraph() {
 
     ExtractExecutableNodes();
 
+    InitShapeCache();
+
     status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -472,6 +531,42 @@ void Graph::ExtractExecutableNodes() {
     }
 }
 
+void Graph::InitShapeCache() {
+    shapeCache.reset();
+    shapeCacheChecked = false;
+    shapeCacheHits = 0;
+    shapeCacheMisses = 0;
+
+    // the output shapes of the nodes following a sync point depend on the data, so they can't be reused for the same input shapes
+    const auto capacity = getConfig().shapeCacheCapacity;
+    const bool hasDynNodes = std::any_of(executableGraphNodes.begin(), executableGraphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode();
+    });
+    if (0 == capacity || !hasDynNodes || !syncNodesInds.empty())
+        return;
+
+    std::vector<NodePtr> inputNodes;
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), Type::Input, Type::MemoryInput) && !node->isConstant() && !node->getChildEdges().empty()) {
+            inputNodes.push_back(node);
+        }
+    }
+    shapeCache.reset(new ShapeCache(std::move(inputNodes), capacity));
+}
+
+bool Graph::IsShapeCacheApplicable() const {
+    // Must be called before the first inference. As long as the nodes have not been executed yet, all the nodes which infer
+    // the output shapes from the input shapes request the shape inference. The rest of the dynamic nodes define the output shapes
+    // during the execution, thus the shapes of the graph can't be cached.
+    for (const auto& node : executableGraphNodes) {
+        if (node->isDynamicNode() && !one_of(node->getType(), Type::Input, Type::Output, Type::MemoryInput) && !node->needShapeInfer()) {
+            DEBUG_LOG("Shape cache is disabled for graph ", GetName(), " due to node ", node->getName());
+            return false;
+        }
+    }
+    return true;
+}
+
 void Graph::CreatePrimitivesAndExecConstants() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     dnnl::stream stream(getEngine());
@@ -729,13 +824,19 @@ void Graph::AllocateWithReuse() {
         }
     }
 
-    const int64_t alignment = 32;  // 32 bytes
+    // the boxes are aligned to the cache line, so the tensors never share the cache lines
+    const int64_t alignment = 64;
+    // the dynamic tensors are planned statically against their upper bounds if the bound is reasonable,
+    // otherwise the memory is allocated on demand
+    const int64_t maxBoundedBoxSize = 256 * 1024 * 1024;
 
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
+    std::vector<MemorySolver::Box> boundedBoxes;
     for (size_t i = 0; i < remaining_edge_clusters_count; i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i) };
         int64_t boxSize = 0;
+        int64_t boxMaxSize = 0;
         for (auto &edge : edge_clusters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
@@ -747,6 +848,12 @@ void Graph::AllocateWithReuse() {
                 boxSize = -1;
             }
 
+            if (boxMaxSize != -1 && edge->hasDefinedMaxSize()) {
+                boxMaxSize = std::max(static_cast<int64_t>(edge->getDesc().getMaxMemSize()), boxMaxSize);
+            } else {
+                boxMaxSize = -1;
+            }
+
             box.start = std::min(e_start, box.start);
             box.finish = std::max(e_finish, box.finish);
         }
@@ -774,14 +881,54 @@ void Graph::AllocateWithReuse() {
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
             definedBoxes.push_back(box);
+        } else if (!isOutput && boxMaxSize > 0 && boxMaxSize <= maxBoundedBoxSize) {
+            // the output edges get the proxy memory managers below
+            box.size = div_up(boxMaxSize, alignment);
+            boundedBoxes.push_back(box);
         } else {
             box.size = boxSize;
             undefinedBoxes.push_back(box);
         }
     }
 
+    //We have to extend the lifespan of tensors that are crossing a sync point border in order to save
+    //the intermediate computation results from possible loss due to the tensor resize
+    auto extendLifespan = [&](std::vector<MemorySolver::Box>& boxes) {
+        if (syncNodesInds.empty())
+            return;
+        std::vector<int> vecIntervals = {0};
+        for (const auto& item : syncNodesInds) {
+            vecIntervals.push_back(item.first->execIndex);
+        }
+        std::sort(vecIntervals.begin(), vecIntervals.end());
+        for (auto& box : boxes) {
+            if (-1 == box.finish) {
+                continue;
+            }
+            auto itr_upper = std::upper_bound(vecIntervals.begin(), vecIntervals.end(), box.finish, [](int y, int x) { return y <= x;});
+            auto itr_lower = std::lower_bound(vecIntervals.begin(), vecIntervals.end(), box.start);
+            if (itr_lower != itr_upper) { // across sections
+                if (itr_upper == vecIntervals.end()) {
+                    box.finish = -1;
+                } else {
+                    box.finish = *itr_upper;
+                }
+            }
+        }
+    };
+
+    extendLifespan(boundedBoxes);
+    std::unordered_set<int64_t> boundedBoxIds;
+    for (const auto& box : boundedBoxes) {
+        boundedBoxIds.insert(box.id);
+        definedBoxes.push_back(box);
+    }
+
     MemorySolver staticMemSolver(definedBoxes);
     size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+    workspaceSize = total_size;
+    // the part of the workspace which is not occupied by the tensors alive at the peak moment
+    workspaceFragmentation = total_size ? 1.f - static_cast<float>(staticMemSolver.maxDepth() * alignment) / total_size : 0.f;
 
     memWorkspace = std::make_shared<Memory>(getEngine(), DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
 
@@ -792,9 +939,18 @@ void Graph::AllocateWithReuse() {
 
     for (auto& box : definedBoxes) {
         int count = 0;
+        const bool isBounded = boundedBoxIds.count(box.id) > 0;
         for (auto& edge : edge_clusters[box.id]) {
             if (edge->getStatus() == Edge::Status::NeedAllocation) {
                 int64_t offset = staticMemSolver.getOffset(box.id);
+                if (isBounded) {
+                    // the memory is reallocated only if the upper bound is exceeded
+                    auto memMngr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
+                    memMngr->setExtBuff(workspace_ptr + offset * alignment, box.size * alignment);
+                    edge->allocate(memMngr);
+                    count++;
+                    continue;
+                }
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
                 edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
@@ -838,29 +994,7 @@ void Graph::AllocateWithReuse() {
             }
         }
 
-        if (!syncNodesInds.empty()) {
-            //We have to extend the lifespan of tensors that are crossing a sync point border in order to save
-            //the intermediate computation results from possible loss due to the tensor resize
-            std::vector<int> vecIntervals = {0};
-            for (const auto& item : syncNodesInds) {
-                vecIntervals.push_back(item.first->execIndex);
-            }
-            std::sort(vecIntervals.begin(), vecIntervals.end());
-            for (auto& box : undefinedBoxes) {
-                if (-1 == box.finish) {
-                    continue;
-                }
-                auto itr_upper = std::upper_bound(vecIntervals.begin(), vecIntervals.end(), box.finish, [](int y, int x) { return y <= x;});
-                auto itr_lower = std::lower_bound(vecIntervals.begin(), vecIntervals.end(), box.start);
-                if (itr_lower != itr_upper) { // across sections
-                    if (itr_upper == vecIntervals.end()) {
-                        box.finish = -1;
-                    } else {
-                        box.finish = *itr_upper;
-                    }
-                }
-            }
-        }
+        extendLifespan(undefinedBoxes);
 
         MemorySolver::normalizeBoxes(undefinedBoxes);
 
@@ -1117,6 +1251,51 @@ void Graph::InferStatic(InferRequestBase* request) {
 
 namespace {
 
+/**
+ * Updates the output shapes of the node either running the shape inference or reusing the shapes from the shape cache.
+ * In the former case the resulting shapes may be recorded to be put into the shape cache.
+ */
+class UpdateShapes {
+public:
+    struct Record {
+        explicit Record(size_t nodesNum) : shapes(nodesNum) {}
+        ShapeCache::NodesShapes shapes;
+        bool complete = true;
+    };
+
+    UpdateShapes() = default;
+    UpdateShapes(ShapeCache::NodesShapesCPtr cached, Record* recorded) : m_cached(std::move(cached)), m_recorded(recorded) {}
+
+    void operator()(const NodePtr& node, size_t node_indx) const {
+        if (m_cached) {
+            node->updateShapes((*m_cached)[node_indx]);
+            return;
+        }
+        node->updateShapes();
+        if (m_recorded && m_recorded->complete) {
+            auto& shapes = m_recorded->shapes[node_indx];
+            for (const auto& edge_w : node->getChildEdges()) {
+                const auto edge = edge_w.lock();
+                const size_t port = edge->getInputNum();
+                if (shapes.size() <= port) {
+                    shapes.resize(port + 1);
+                }
+                const auto& shape = edge->getMemory().getShape();
+                if (!shape.isStatic()) {
+                    // the output shapes are not inferred from the input shapes, so the graph shapes can't be cached
+                    m_recorded->complete = false;
+                    return;
+                }
+                shapes[port] = shape.getStaticDims();
+            }
+        }
+    }
+
+private:
+    ShapeCache::NodesShapesCPtr m_cached;
+    Record* m_recorded = nullptr;
+};
+
 class IUpdateNodes {
 public:
     virtual void run(size_t stopIndx) = 0;
@@ -1125,12 +1304,13 @@ public:
 
 class UpdateNodesSeq : public IUpdateNodes {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, UpdateShapes updateShapes = {}) :
+        m_executableGraphNodes(executableGraphNodes), m_updateShapes(std::move(updateShapes)) {}
     void run(size_t stopIndx) override {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                m_updateShapes(node, prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1139,6 +1319,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    UpdateShapes m_updateShapes;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1148,13 +1329,14 @@ private:
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_OMP)
 class UpdateNodesBase : public IUpdateNodes {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, UpdateShapes updateShapes = {}) :
+        m_executableGraphNodes(executableGraphNodes), m_updateShapes(std::move(updateShapes)) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    m_updateShapes(node, i);
                 }
                 m_prepareCounter.store(i, std::memory_order::memory_order_release);
             }
@@ -1188,6 +1370,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    UpdateShapes m_updateShapes;
 };
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -1323,11 +1506,33 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    if (shapeCache && !shapeCacheChecked) {
+        shapeCacheChecked = true;
+        if (!IsShapeCacheApplicable()) {
+            shapeCache.reset();
+        }
+    }
+
+    UpdateShapes updateShapes;
+    ShapeCache::Key shapeCacheKey;
+    std::unique_ptr<UpdateShapes::Record> recordedShapes;
+    if (shapeCache) {
+        shapeCacheKey = shapeCache->makeKey();
+        if (auto cachedShapes = shapeCache->get(shapeCacheKey)) {
+            shapeCacheHits++;
+            updateShapes = UpdateShapes(std::move(cachedShapes), nullptr);
+        } else {
+            shapeCacheMisses++;
+            recordedShapes.reset(new UpdateShapes::Record(executableGraphNodes.size()));
+            updateShapes = UpdateShapes(nullptr, recordedShapes.get());
+        }
+    }
+
     std::unique_ptr<IUpdateNodes> updateNodes{};
     if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, std::move(updateShapes)));
     } else {
-        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
+        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes, std::move(updateShapes)));
     }
     size_t inferCounter = 0;
 
@@ -1343,6 +1548,10 @@ void Graph::InferDynamic(InferRequestBase* request) {
             ExecuteNode(node, stream);
         }
     }
+
+    if (recordedShapes && recordedShapes->complete) {
+        shapeCache->put(shapeCacheKey, std::make_shared<ShapeCache::NodesShapes>(std::move(recordedShapes->shapes)));
+    }
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
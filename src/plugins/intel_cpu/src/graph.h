@@ -26,6 +26,7 @@ namespace intel_cpu {
 
 class InferRequestBase;
 class InferRequest;
+class ShapeCache;
 
 class Graph {
 public:
@@ -194,6 +195,37 @@ public:
 
     Status getStatus() const {return status;}
 
+    /**
+     * @brief Returns the number of dynamic inferences which reused the nodes output shapes stored in the shape cache
+     * for the current set of the graph input shapes.
+     */
+    uint64_t getShapeCacheHits() const {
+        return shapeCacheHits;
+    }
+
+    /**
+     * @brief Returns the number of dynamic inferences which performed the nodes shape inference since the current set of
+     * the graph input shapes had not been cached yet.
+     */
+    uint64_t getShapeCacheMisses() const {
+        return shapeCacheMisses;
+    }
+
+    /**
+     * @brief Returns the size in bytes of the workspace shared by the static and the bounded dynamic tensors.
+     */
+    uint64_t getWorkspaceSize() const {
+        return workspaceSize;
+    }
+
+    /**
+     * @brief Returns the fraction of the workspace which is not occupied by the tensors alive at the peak moment
+     * of the graph execution, i.e. the memory lost because of the planning.
+     */
+    float getWorkspaceFragmentation() const {
+        return workspaceFragmentation;
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -216,6 +248,8 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    uint64_t workspaceSize = 0;
+    float workspaceFragmentation = 0.f;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -237,6 +271,8 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
+    void InitShapeCache();
+    bool IsShapeCacheApplicable() const;
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(InferRequestBase* request);
@@ -261,6 +297,13 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // the output shapes of the dynamic nodes per set of the graph input shapes, so the repeated input shapes
+    // don't require the shape inference of every node
+    std::unique_ptr<ShapeCache> shapeCache;
+    bool shapeCacheChecked = false;
+    uint64_t shapeCacheHits = 0;
+    uint64_t shapeCacheMisses = 0;
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
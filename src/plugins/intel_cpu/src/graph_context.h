@@ -21,12 +21,17 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 MultiCachePtr paramsCache = nullptr,
+                 RepackedWeights::CPtr repackedWeights = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          repackedWeights(repackedWeights),
+          rtParamsCache(paramsCache),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!rtParamsCache)
+            rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
     }
 
@@ -42,6 +47,9 @@ public:
         return weightsCache;
     }
 
+    RepackedWeights::CPtr getRepackedWeights() const {
+        return repackedWeights;
+    }
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
@@ -64,8 +72,9 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    RepackedWeights::CPtr repackedWeights;    // weights repacked by the graph the model blob was exported from
 
-    MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr rtParamsCache;     // primitive cache, may be shared between the graphs of the streams on the same socket
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
@@ -91,6 +91,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseFCAndConvertOnWeights(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseDeconvolutionAndSimpleOperation");
     FuseDeconvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -713,6 +717,120 @@ void GraphOptimizer::FuseFCAndConvertOnWeights(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph& graph) {
+    // This optimization fuses the decompression subgraph of the INT8/INT4 weights
+    // Constant(U8/I8) -> Convert(FP32/BF16) -> [Subtract(zero point)] -> Multiply(scale) -> [Reshape] -> FullyConnected
+    // into FullyConnected, so the weights stay compressed in memory and are decompressed on the fly by the FC gemm
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstInput = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant();
+    };
+
+    auto readParam = [](const NodePtr& constNode, const VectorDims& weightsDims, WeightsDecompressionParam& param) {
+        auto constInput = dynamic_cast<node::Input*>(constNode.get());
+        if (constInput == nullptr)
+            IE_THROW() << "Cannot cast " << constNode->getName() << " to Input node";
+        auto mem = constInput->getMemoryPtr();
+        if (!mem || !mem->getShape().isStatic())
+            return false;
+        const auto& dims = mem->getStaticDims();
+        const auto size = mem->getShape().getElementsCount();
+        std::vector<float> data(size);
+        cpu_convert(mem->getData(), data.data(), mem->getDesc().getPrecision(), Precision::FP32, size);
+        return param.init(data.data(), dims, weightsDims);
+    };
+
+    for (const auto& fc : graphNodes) {
+        if (fc->getType() != Type::FullyConnected || !fc->getFusedWith().empty())
+            continue;
+        if (one_of(fc->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8))
+            continue;
+        const auto& fcWeightsShape = fc->getInputShapeAtPort(1);
+        if (!fcWeightsShape.isStatic() || fcWeightsShape.getRank() != 2)
+            continue;
+
+        NodePtr reshape, subtract, zeroPointConvert, zeroPoint;
+        auto multiply = fc->getParentEdgeAt(1)->getParent();
+        if (multiply->getType() == Type::Reshape) {
+            reshape = multiply;
+            if (!reshape->isConstant() || reshape->getChildEdges().size() != 1)
+                continue;
+            multiply = reshape->getParentEdgeAt(0)->getParent();
+        }
+        if (multiply->getType() != Type::Eltwise || multiply->getAlgorithm() != Algorithm::EltwiseMultiply ||
+            !multiply->isConstant() || multiply->getChildEdges().size() != 1 || multiply->getParentEdges().size() != 2)
+            continue;
+        const auto scale = multiply->getParentEdgeAt(1)->getParent();
+        if (!isConstInput(scale))
+            continue;
+
+        auto convert = multiply->getParentEdgeAt(0)->getParent();
+        if (convert->getType() == Type::Eltwise && convert->getAlgorithm() == Algorithm::EltwiseSubtract) {
+            subtract = convert;
+            if (subtract->getChildEdges().size() != 1 || subtract->getParentEdges().size() != 2)
+                continue;
+            zeroPoint = subtract->getParentEdgeAt(1)->getParent();
+            if (zeroPoint->getType() == Type::Convert && zeroPoint->getChildEdges().size() == 1) {
+                zeroPointConvert = zeroPoint;
+                zeroPoint = zeroPointConvert->getParentEdgeAt(0)->getParent();
+            }
+            if (!isConstInput(zeroPoint))
+                continue;
+            convert = subtract->getParentEdgeAt(0)->getParent();
+        }
+        if (convert->getType() != Type::Convert || convert->getChildEdges().size() != 1 ||
+            !one_of(convert->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8) ||
+            !one_of(convert->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+            continue;
+        const auto weights = convert->getParentEdgeAt(0)->getParent();
+        if (!isConstInput(weights) || weights->getChildEdges().size() != 1)
+            continue;
+
+        // the compressed weights must be [N, K] once flattened, as the FC gemm reads them row by row
+        const auto& weightsShape = convert->getInputShapeAtPort(0);
+        if (!weightsShape.isStatic() || weightsShape.getRank() < 2)
+            continue;
+        const auto& weightsDims = weightsShape.getStaticDims();
+        const auto& fcWeightsDims = fcWeightsShape.getStaticDims();
+        if (weightsDims[0] != fcWeightsDims[0] ||
+            std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>()) != fcWeightsDims[1])
+            continue;
+
+        WeightsDecompressionParam scaleParam, zeroPointParam;
+        if (!readParam(scale, weightsDims, scaleParam))
+            continue;
+        if (zeroPoint && !readParam(zeroPoint, weightsDims, zeroPointParam))
+            continue;
+
+        auto scaleEdge = multiply->getParentEdgeAt(1);
+        graph.RemoveEdge(scaleEdge);
+        graph.DropNode(multiply);
+        if (subtract) {
+            auto zeroPointEdge = subtract->getParentEdgeAt(1);
+            graph.RemoveEdge(zeroPointEdge);
+            if (zeroPointConvert) {
+                auto zeroPointConvertEdge = zeroPointConvert->getParentEdgeAt(0);
+                graph.RemoveEdge(zeroPointConvertEdge);
+            }
+            graph.DropNode(subtract);
+        }
+        graph.DropNode(convert);
+
+        const auto weightsPrc = convert->getOriginalInputPrecisionAtPort(0);
+        if (reshape) {
+            reshape->setOriginalInputPrecisionAtPort(0, weightsPrc);
+            reshape->setOriginalOutputPrecisionAtPort(0, weightsPrc);
+        }
+        fc->setOriginalInputPrecisionAtPort(1, weightsPrc);
+        fc->addOriginalLayer(multiply->getOriginalLayers());
+        auto fcNode = std::dynamic_pointer_cast<node::FullyConnected>(fc);
+        if (fcNode == nullptr)
+            IE_THROW() << "Cannot cast " << fc->getName() << " to FullyConnected node";
+        fcNode->fuseWeightsDecompression(std::move(scaleParam), std::move(zeroPointParam));
+    }
+}
+
 void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
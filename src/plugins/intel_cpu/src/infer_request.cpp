@@ -105,12 +105,9 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    // the graph works with the state memory of the request directly
+                    auto cur_state = std::static_pointer_cast<VariableState>(state);
+                    cur_node->bindStore(cur_state->getInputMem(), cur_state->getOutputMem());
                 }
             }
         }
@@ -127,12 +124,8 @@ void InferRequestBase::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    // the new state was stored to the request memory, no copy is needed
+                    std::static_pointer_cast<VariableState>(state)->commit();
                 }
             }
         }
@@ -6,15 +6,89 @@
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <functional>
+
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+// Exposes the current state buffer, so the state blob stays the same when the buffers are swapped
+class StateBuffersAllocator : public IAllocator {
+public:
+    explicit StateBuffersAllocator(std::function<void*()> current) : _current(std::move(current)) {}
+
+    void* lock(void*, LockOp) noexcept override {
+        return _current();
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t) noexcept override {
+        return _current();
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+
+private:
+    std::function<void*()> _current;
+};
+}   // namespace
+
+VariableState::VariableState(std::string name, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name}, m_buffers(std::make_shared<Buffers>()) {
+    const auto engine = storage->getPrimitive().get_engine();
+    for (auto& memory : m_buffers->memory)
+        memory = std::make_shared<Memory>(engine, storage->getDesc());
+    cpu_memcpy(m_buffers->memory[m_buffers->current]->getData(), storage->getData(), storage->getSize());
+
+    // the allocator keeps the buffers alive, as the blob may outlive the infer request
+    const auto buffers = m_buffers;
+    const auto allocator = std::make_shared<StateBuffersAllocator>([buffers] {
+        return buffers->memory[buffers->current]->getData();
+    });
+    m_stateBlob = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()), allocator);
+    m_stateBlob->allocate();
+    state = m_stateBlob;
+}
+
 void VariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+MemoryPtr VariableState::getInputMem() {
+    const auto& current = m_buffers->memory[m_buffers->current];
+    if (!isUserState())
+        return current;
+
+    if (state != m_userBlob) {
+        const auto& desc = current->getDesc();
+        if (state->byteSize() != current->getSize())
+            IE_THROW() << "State " << GetName() << " has size " << state->byteSize() << " bytes, but "
+                       << current->getSize() << " bytes are expected";
+        m_userMemory = std::make_shared<Memory>(current->getPrimitive().get_engine(), desc,
+                                                state->buffer().as<void*>(), false);
+        m_userBlob = state;
+    }
+    return m_userMemory;
+}
+
+MemoryPtr VariableState::getOutputMem() {
+    // the user's blob keeps the state, so the new state overwrites the previous one
+    if (isUserState())
+        return getInputMem();
+    return m_buffers->memory[m_buffers->current ^ 1];
+}
+
+void VariableState::commit() {
+    if (isUserState())
+        return;
+    // the state blob locks the current buffer, so it refers to the new state from now on
+    m_buffers->current ^= 1;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,21 +10,47 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The state of the infer request. The state data is double buffered: during the inference the state is read
+ * from the current buffer and the new state is stored to the other one, then the buffers are swapped, so the state
+ * is neither copied to the graph nor back. The blob returned by GetState always refers to the current buffer, so it
+ * keeps showing the latest state after the swaps, only the pointers taken from it are valid until the next inference.
+ * The blob set by the user is used as the state storage as is.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->getData(), storage->getSize());
-    }
+    VariableState(std::string name, MemoryPtr storage);
 
     void Reset() override;
+
+    // the memory the state is read from during the inference
+    MemoryPtr getInputMem();
+    // the memory the new state is stored to during the inference
+    MemoryPtr getOutputMem();
+    // makes the stored state current, must be called after the inference
+    void commit();
+
+private:
+    // the two state buffers, shared with the allocator of the state blob which locks the current one
+    struct Buffers {
+        std::array<MemoryPtr, 2> memory;
+        size_t current = 0;
+    };
+
+    bool isUserState() const {
+        return state != m_stateBlob;
+    }
+
+    std::shared_ptr<Buffers> m_buffers;
+    InferenceEngine::Blob::Ptr m_stateBlob;
+    InferenceEngine::Blob::Ptr m_userBlob;
+    MemoryPtr m_userMemory;
 };
 
 }   // namespace intel_cpu
@@ -582,6 +582,13 @@ void Node::updateShapes() {
     }
 }
 
+void Node::updateShapes(const std::vector<VectorDims>& outputShapes) {
+    IE_ASSERT(isDynamicNode()) << "Node::updateShapes() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
+    if (needShapeInfer()) {
+        redefineOutputMemory(outputShapes);
+    }
+}
+
 void Node::updateDynamicParams() {
     IE_ASSERT(isDynamicNode()) << "Node::updateDynamicParams() is called to a static shape node of type: " << getTypeStr() << " with name: " << getName();
     if (isExecutable()) {
@@ -875,7 +882,15 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     auto constDnnlMemOutDesc = edgeMem->getDescWithType<DnnlMemoryDesc>();
     auto weightSrcDesc = constDnnlMemOutDesc->getDnnlDesc();
     weightSrcDesc = weightSrcDesc.reshape(weightDesc->getDnnlDesc().get_dims());
-    auto create = [&] () {
+    const auto& format = weightDesc->serializeFormat();
+    auto create = [&] () -> MemoryPtr {
+        // the weights repacked by the graph the model was exported from are used as is
+        if (auto repackedWeights = context->getRepackedWeights()) {
+            if (auto data = repackedWeights->find(getName(), format, weightDesc->getCurrentMemSize())) {
+                return std::make_shared<Memory>(getEngine(), weightDesc, data, false);
+            }
+        }
+
         auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
 
         Memory srcMemory{ getEngine(), newSrcDesc, edgeMem->getData() };
@@ -886,7 +901,6 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     };
 
     MemoryPtr ptr;
-    const auto& format = weightDesc->serializeFormat();
     auto itr = privateWeightCache.find(format);
     if (privateWeightCache.end() != itr) {
         ptr = itr->second;
@@ -361,6 +361,13 @@ public:
 
     virtual void execute(dnnl::stream strm) = 0;
     void updateShapes();
+    /**
+     * @brief Redefines the output memory using the output shapes computed beforehand for the current input shapes
+     * (e.g. taken from the graph shape cache) instead of running the shape inference.
+     * @param outputShapes
+     * the node output shapes
+     */
+    void updateShapes(const std::vector<VectorDims>& outputShapes);
     void updateDynamicParams();
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
@@ -528,6 +535,11 @@ public:
         return internalBlobs;
     }
 
+    // weights reordered into the layouts required by the node primitives, mapped by the serialized format
+    const std::unordered_map<std::string, MemoryPtr>& getRepackedWeights() const {
+        return privateWeightCache;
+    }
+
     /**
     * @brief Return scales and shift if nodes can be executed as ScaleShift, else raise exception
     * If node has only scale or shift value, fill missing value with default values
@@ -0,0 +1,250 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_decompression_gemm.h"
+
+#include <ie_parallel.hpp>
+#include "utils/bfloat16.hpp"
+#include "utils/cpu_utils.hpp"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+bool WeightsDecompressionParam::init(const float* data, const VectorDims& dims, const VectorDims& weightsDims) {
+    if (weightsDims.size() < 2 || dims.size() > weightsDims.size())
+        return false;
+
+    const auto constDims = getNormalizedDimsBySize(dims, weightsDims.size());
+    const size_t N = weightsDims[0];
+    const size_t K = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    if (constDims[0] != 1 && constDims[0] != N)
+        return false;
+
+    // the value may change along the outer dims of K only, so every group of input channels is contiguous
+    size_t groups = 1;
+    size_t i = 1;
+    for (; i < constDims.size() && constDims[i] == weightsDims[i]; i++)
+        groups *= constDims[i];
+    for (; i < constDims.size(); i++) {
+        if (constDims[i] != 1)
+            return false;
+    }
+
+    groupSize = K / groups;
+    strideN = constDims[0] == 1 ? 0 : groups;
+    values.assign(data, data + constDims[0] * groups);
+    return true;
+}
+
+bool weights_fit_into_4bit(const uint8_t* weights, Precision prc, size_t size) {
+    if (prc == Precision::U8)
+        return std::all_of(weights, weights + size, [](uint8_t w) { return w < 16; });
+    if (prc == Precision::I8) {
+        const auto* data = reinterpret_cast<const int8_t*>(weights);
+        return std::all_of(data, data + size, [](int8_t w) { return w >= -8 && w < 8; });
+    }
+    return false;
+}
+
+Precision pack_weights_to_4bit(const uint8_t* src, uint8_t* dst, Precision prc, size_t N, size_t K) {
+    const size_t rowBytes = div_up(K, 2);
+    parallel_for(N, [&](size_t n) {
+        const uint8_t* srcRow = src + n * K;
+        uint8_t* dstRow = dst + n * rowBytes;
+        for (size_t k = 0; k < rowBytes; k++) {
+            const uint8_t low = srcRow[2 * k] & 0x0F;
+            const uint8_t high = 2 * k + 1 < K ? srcRow[2 * k + 1] & 0x0F : 0;
+            dstRow[k] = low | static_cast<uint8_t>(high << 4);
+        }
+    });
+    return prc == Precision::I8 ? Precision::I4 : Precision::U4;
+}
+
+namespace {
+
+struct U8Weights {
+    static size_t rowBytes(size_t K) { return K; }
+    static float get(const uint8_t* row, size_t k) { return row[k]; }
+};
+
+struct I8Weights {
+    static size_t rowBytes(size_t K) { return K; }
+    static float get(const uint8_t* row, size_t k) { return static_cast<int8_t>(row[k]); }
+};
+
+struct U4Weights {
+    static size_t rowBytes(size_t K) { return div_up(K, 2); }
+    static float get(const uint8_t* row, size_t k) {
+        return (row[k >> 1] >> ((k & 1) << 2)) & 0x0F;
+    }
+};
+
+struct I4Weights {
+    static size_t rowBytes(size_t K) { return div_up(K, 2); }
+    static float get(const uint8_t* row, size_t k) {
+        const int v = (row[k >> 1] >> ((k & 1) << 2)) & 0x0F;
+        // sign extension of the nibble
+        return static_cast<float>((v ^ 0x08) - 0x08);
+    }
+};
+
+// output channels computed together, it is the width of the accumulators
+constexpr size_t nBlock = 16;
+// source rows which reuse every decompressed weight loaded from L1
+constexpr size_t mBlock = 4;
+// input channels decompressed at once, so the decompressed block of nBlock * kBlock floats fits into L1
+constexpr size_t kBlock = 256;
+
+inline float paramValue(const WeightsDecompressionParam& param, size_t n, size_t k, float defaultValue) {
+    return param.empty() ? defaultValue : param.values[n * param.strideN + k / param.groupSize];
+}
+
+// the next input channel the scale or the zero point changes at
+inline size_t paramGroupEnd(const WeightsDecompressionParam& param, size_t k, size_t K) {
+    return param.empty() ? K : (k / param.groupSize + 1) * param.groupSize;
+}
+
+// decompresses weights [n0 : n0 + nb, k0 : k0 + kb] into the transposed block [kb, nBlock]
+template <typename W>
+void decompressBlock(float* block, const uint8_t* weights, size_t K,
+                     const WeightsDecompressionParam& scale, const WeightsDecompressionParam& zeroPoint,
+                     size_t n0, size_t nb, size_t k0, size_t kb) {
+    const size_t rowBytes = W::rowBytes(K);
+    for (size_t j = 0; j < nb; j++) {
+        const size_t n = n0 + j;
+        const uint8_t* row = weights + n * rowBytes;
+        size_t k = k0;
+        while (k < k0 + kb) {
+            const size_t kEnd = std::min({k0 + kb, paramGroupEnd(scale, k, K), paramGroupEnd(zeroPoint, k, K)});
+            const float s = paramValue(scale, n, k, 1.f);
+            const float zp = paramValue(zeroPoint, n, k, 0.f);
+            for (; k < kEnd; k++)
+                block[(k - k0) * nBlock + j] = (W::get(row, k) - zp) * s;
+        }
+    }
+    for (size_t j = nb; j < nBlock; j++) {
+        for (size_t k = 0; k < kb; k++)
+            block[k * nBlock + j] = 0.f;
+    }
+}
+
+template <typename W, typename TSrc, typename TDst>
+void gemm(const TSrc* src, const uint8_t* weights,
+          const WeightsDecompressionParam& scale, const WeightsDecompressionParam& zeroPoint,
+          const float* bias, TDst* dst, size_t M, size_t N, size_t K,
+          const std::vector<WeightsDecompressionPostOp>& postOps) {
+    const size_t nBlocks = div_up(N, nBlock);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(nBlocks, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> block(kBlock * nBlock);
+        // FP32 partial sums of all the rows, so dst is written once in its own precision
+        std::vector<float> partialSums(M * nBlock);
+        for (size_t nbi = start; nbi < end; nbi++) {
+            const size_t n0 = nbi * nBlock;
+            const size_t nb = std::min(nBlock, N - n0);
+
+            for (size_t k0 = 0; k0 < K; k0 += kBlock) {
+                const size_t kb = std::min(kBlock, K - k0);
+                decompressBlock<W>(block.data(), weights, K, scale, zeroPoint, n0, nb, k0, kb);
+
+                for (size_t m0 = 0; m0 < M; m0 += mBlock) {
+                    const size_t mb = std::min(mBlock, M - m0);
+                    float acc[mBlock][nBlock] = {};
+                    for (size_t i = 0; i < mb; i++) {
+                        const float* sums = partialSums.data() + (m0 + i) * nBlock;
+                        for (size_t j = 0; j < nb; j++)
+                            acc[i][j] = k0 != 0 ? sums[j] : (bias ? bias[n0 + j] : 0.f);
+                    }
+
+                    for (size_t k = 0; k < kb; k++) {
+                        const float* w = block.data() + k * nBlock;
+                        for (size_t i = 0; i < mb; i++) {
+                            const float a = static_cast<float>(src[(m0 + i) * K + k0 + k]);
+                            for (size_t j = 0; j < nBlock; j++)
+                                acc[i][j] += a * w[j];
+                        }
+                    }
+
+                    for (size_t i = 0; i < mb; i++) {
+                        float* sums = partialSums.data() + (m0 + i) * nBlock;
+                        for (size_t j = 0; j < nb; j++)
+                            sums[j] = acc[i][j];
+                    }
+                }
+            }
+
+            for (size_t m = 0; m < M; m++) {
+                float* sums = partialSums.data() + m * nBlock;
+                for (const auto& postOp : postOps)
+                    postOp(sums, n0, nb);
+                TDst* dstRow = dst + m * N + n0;
+                for (size_t j = 0; j < nb; j++)
+                    dstRow[j] = static_cast<TDst>(sums[j]);
+            }
+        }
+    });
+}
+
+template <typename TSrc, typename TDst>
+void gemm(const void* src, const uint8_t* weights, Precision weightsPrc,
+          const WeightsDecompressionParam& scale, const WeightsDecompressionParam& zeroPoint,
+          const float* bias, void* dst, size_t M, size_t N, size_t K,
+          const std::vector<WeightsDecompressionPostOp>& postOps) {
+    const auto* typedSrc = reinterpret_cast<const TSrc*>(src);
+    auto* typedDst = reinterpret_cast<TDst*>(dst);
+    switch (weightsPrc) {
+    case Precision::U8:
+        return gemm<U8Weights>(typedSrc, weights, scale, zeroPoint, bias, typedDst, M, N, K, postOps);
+    case Precision::I8:
+        return gemm<I8Weights>(typedSrc, weights, scale, zeroPoint, bias, typedDst, M, N, K, postOps);
+    case Precision::U4:
+        return gemm<U4Weights>(typedSrc, weights, scale, zeroPoint, bias, typedDst, M, N, K, postOps);
+    case Precision::I4:
+        return gemm<I4Weights>(typedSrc, weights, scale, zeroPoint, bias, typedDst, M, N, K, postOps);
+    default:
+        IE_THROW() << "Weights decompression gemm doesn't support weights precision: " << weightsPrc.name();
+    }
+}
+
+}  // namespace
+
+void weights_decompression_gemm(const void* src,
+                                Precision srcPrc,
+                                const uint8_t* weights,
+                                Precision weightsPrc,
+                                const WeightsDecompressionParam& scale,
+                                const WeightsDecompressionParam& zeroPoint,
+                                const float* bias,
+                                void* dst,
+                                Precision dstPrc,
+                                size_t M,
+                                size_t N,
+                                size_t K,
+                                const std::vector<WeightsDecompressionPostOp>& postOps) {
+    if (!one_of(srcPrc, Precision::FP32, Precision::BF16) || !one_of(dstPrc, Precision::FP32, Precision::BF16))
+        IE_THROW() << "Weights decompression gemm doesn't support data precisions: " << srcPrc.name() << " -> " << dstPrc.name();
+
+    if (srcPrc == Precision::FP32 && dstPrc == Precision::FP32)
+        return gemm<float, float>(src, weights, weightsPrc, scale, zeroPoint, bias, dst, M, N, K, postOps);
+    if (srcPrc == Precision::FP32)
+        return gemm<float, bfloat16_t>(src, weights, weightsPrc, scale, zeroPoint, bias, dst, M, N, K, postOps);
+    if (dstPrc == Precision::FP32)
+        return gemm<bfloat16_t, float>(src, weights, weightsPrc, scale, zeroPoint, bias, dst, M, N, K, postOps);
+    return gemm<bfloat16_t, bfloat16_t>(src, weights, weightsPrc, scale, zeroPoint, bias, dst, M, N, K, postOps);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
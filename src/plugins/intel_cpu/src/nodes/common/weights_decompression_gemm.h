@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+#include <cpu_types.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Scale or zero point of the compressed weights [N, K]. It is defined per tensor, per output channel
+ * or per group of input channels, so the value for the weight (n, k) is values[n * strideN + k / groupSize]
+ */
+struct WeightsDecompressionParam {
+    std::vector<float> values;
+    size_t strideN = 0;
+    size_t groupSize = 0;
+
+    bool empty() const {
+        return values.empty();
+    }
+
+    /**
+     * @brief Initializes the parameter from the constant which is broadcasted to the weights before they are
+     * flattened to [N, K]
+     * @param data
+     * constant values
+     * @param dims
+     * constant dims
+     * @param weightsDims
+     * dims of the compressed weights, the first one is N
+     * @return false if the constant is not per tensor, per output channel or per group of input channels
+     */
+    bool init(const float* data, const VectorDims& dims, const VectorDims& weightsDims);
+};
+
+/**
+ * @brief Checks whether 8 bit weights fit into 4 bits, so they can be packed by pack_weights_to_4bit
+ * @param weights
+ * U8 or I8 weights
+ * @param prc
+ * precision of the weights
+ * @param size
+ * number of the weights
+ */
+bool weights_fit_into_4bit(const uint8_t* weights, InferenceEngine::Precision prc, size_t size);
+
+/**
+ * @brief Packs U8/I8 weights [N, K] into U4/I4 weights, two values per byte and (K + 1) / 2 bytes per row
+ * @param src
+ * U8 or I8 weights
+ * @param dst
+ * destination buffer of N * ((K + 1) / 2) bytes
+ * @return precision of the packed weights
+ */
+InferenceEngine::Precision pack_weights_to_4bit(const uint8_t* src, uint8_t* dst, InferenceEngine::Precision prc,
+                                                size_t N, size_t K);
+
+/**
+ * @brief Post operation applied in place to the FP32 output channels [n0, n0 + count) of one output row
+ */
+using WeightsDecompressionPostOp = std::function<void(float* data, size_t n0, size_t count)>;
+
+/**
+ * @brief Computes dst[M, N] = postOps(src[M, K] * W^T + bias), where the compressed weights W[N, K] are decompressed
+ * on the fly as (w - zeroPoint) * scale, block by block, so they are read from memory once in compressed form.
+ * The products are accumulated in FP32, src and dst may be FP32 or BF16
+ * @param weights
+ * U8/I8 weights with K bytes per row or U4/I4 weights packed by pack_weights_to_4bit
+ * @param zeroPoint
+ * may be empty
+ * @param bias
+ * may be nullptr
+ * @param postOps
+ * applied in order to the accumulated output before it is stored to dst
+ */
+void weights_decompression_gemm(const void* src,
+                                InferenceEngine::Precision srcPrc,
+                                const uint8_t* weights,
+                                InferenceEngine::Precision weightsPrc,
+                                const WeightsDecompressionParam& scale,
+                                const WeightsDecompressionParam& zeroPoint,
+                                const float* bias,
+                                void* dst,
+                                InferenceEngine::Precision dstPrc,
+                                size_t M,
+                                size_t N,
+                                size_t K,
+                                const std::vector<WeightsDecompressionPostOp>& postOps = {});
+
+}   // namespace intel_cpu
+}   // namespace ov
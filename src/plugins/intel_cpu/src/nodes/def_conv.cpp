@@ -883,7 +883,8 @@ void DeformableConvolution::initSupportedPrimitiveDescriptors() {
 }
 
 void DeformableConvolution::DefConvExecutor::prepareSamplingWeights(
-        const float* offsets, const float* modulation, bool enforceRef) {
+        const float* offsets, const float* modulation, int* pSampledCoordsVector, float* pInterpWeightsVector,
+        bool enforceRef) const {
     const int MB = jcp.mb;
     const int OH = jcp.oh;
     const int OW = jcp.ow;
@@ -1015,8 +1016,6 @@ DeformableConvolution::DefConvExecutor::DefConvExecutor(const DefConvAttr &defCo
     offStrides = descVector[OFF_ID]->getStrides();
     weiStrides = descVector[WEI_ID]->getStrides();
     dstStrides = std::vector<size_t>(dstDesc->getStrides().size());
-    pSampledCoordsVector = nullptr;
-    pInterpWeightsVector = nullptr;
     for (size_t i = 0; i < srcDesc->getStrides().size(); i++) {
         srcStrides[srcDesc->getOrder()[i]] = srcDesc->getStrides()[i];
     }
@@ -1104,9 +1103,7 @@ DeformableConvolution::DefConvJitExecutor::DefConvJitExecutor(const DefConvAttr
 void DeformableConvolution::DefConvRefExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
         int *pSampledCoordsVector, float *pInterpWeightsVector) {
-    this->pSampledCoordsVector = pSampledCoordsVector;
-    this->pInterpWeightsVector = pInterpWeightsVector;
-    prepareSamplingWeights(offsets, modulation, true);
+    prepareSamplingWeights(offsets, modulation, pSampledCoordsVector, pInterpWeightsVector, true);
     const int G = jcp.ngroups;
     const int MB = jcp.mb;
     const int OH = jcp.oh;
@@ -1242,10 +1239,9 @@ void DeformableConvolution::executeDynamicImpl(dnnl::stream strm) {
 void DeformableConvolution::DefConvJitExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
         int *pSampledCoordsVector, float *pInterpWeightsVector) {
-    this->pSampledCoordsVector = pSampledCoordsVector;
-    this->pInterpWeightsVector = pInterpWeightsVector;
-    prepareSamplingWeights(offsets, modulation, false);
-    size_t buffer_size = (size_t)jcp.nthr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic * jcp.typesize_in;
+    prepareSamplingWeights(offsets, modulation, pSampledCoordsVector, pInterpWeightsVector, false);
+    // the executor may be shared with a stream running another number of threads, so the buffer is sized per call
+    size_t buffer_size = (size_t)parallel_get_max_threads() * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic * jcp.typesize_in;
     std::vector<float> input_buffer(buffer_size, 0);
     float* input_buffer_ptr = input_buffer.data();
 
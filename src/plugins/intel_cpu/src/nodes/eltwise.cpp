@@ -1548,16 +1548,17 @@ public:
                            });
         } else {
             // execute Optimized Generic
+            // the executor may be shared between streams, so the runtime work amount is not stored back
+            size_t schedulerWorkAmount = _schedulerWorkAmount;
             if (_pKernel->jep_.use_runtime_ptrs) {
-                // recalculate _schedulerWorkAmount
-                _schedulerWorkAmount = 1;
+                schedulerWorkAmount = 1;
                 for (size_t i = 0; i < dims_out.size() - 1; i++) {
-                    _schedulerWorkAmount *= dims_out[i];
+                    schedulerWorkAmount *= dims_out[i];
                 }
             }
             parallel_nt(0, [&](const int ithr, const int nthr) {
                 size_t start = 0, end = 0;
-                splitter(_schedulerWorkAmount, nthr, ithr, start, end);
+                splitter(schedulerWorkAmount, nthr, ithr, start, end);
 
                 std::vector<size_t> counters(dims_out.size() - 1, 0);
                 auto args = jit_eltwise_call_args_indexes();
@@ -2,14 +2,22 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
 #include "ie_parallel.hpp"
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/core/type/float16.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+#include <xmmintrin.h>
+#endif
 
 using namespace InferenceEngine;
 
@@ -46,9 +54,155 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+void EmbeddingBagSum::collectBags(size_t outputBagsNum) {
+    _bags.resize(outputBagsNum);
+    _bagsWork.resize(outputBagsNum);
+
+    size_t work = 0lu;
+    for (size_t obi = 0lu; obi < outputBagsNum; obi++) {
+        auto& bag = _bags[obi];
+        bag.indices = nullptr;
+        bag.size = 0lu;
+        bag.weightsIdx = 0;
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        if (bag.indices == nullptr)
+            bag.size = 0lu;
+
+        // every bag costs at least its output row
+        work += bag.size + 1lu;
+        _bagsWork[obi] = work;
+    }
+}
+
+namespace {
+
+// BF16 and FP16 tables are accumulated in FP32, the other precisions are accumulated in their own type
+template <typename T>
+struct Accumulator {
+    using type = T;
+};
+
+template <>
+struct Accumulator<bfloat16_t> {
+    using type = float;
+};
+
+template <>
+struct Accumulator<ov::float16> {
+    using type = float;
+};
+
+template <typename T>
+inline T load(T value) {
+    return value;
+}
+
+inline float load(bfloat16_t value) {
+    return static_cast<float>(value);
+}
+
+inline float load(ov::float16 value) {
+    // branch light FP16 to FP32 conversion, which can be inlined into the row loops unlike ov::float16::operator float
+    static constexpr uint32_t shiftedExp = 0x7c00u << 13;
+    static constexpr uint32_t magicBits = 113u << 23;
+    const uint16_t h = value.to_bits();
+
+    uint32_t bits = static_cast<uint32_t>(h & 0x7fffu) << 13;
+    const uint32_t exp = bits & shiftedExp;
+    bits += (127u - 15u) << 23;
+    if (exp == shiftedExp) {
+        // Inf/NaN
+        bits += (128u - 16u) << 23;
+    } else if (exp == 0u) {
+        // zero/denormal, renormalized by the FP32 subtraction
+        bits += 1u << 23;
+        float f, magic;
+        std::memcpy(&f, &bits, sizeof(f));
+        std::memcpy(&magic, &magicBits, sizeof(magic));
+        f -= magic;
+        std::memcpy(&bits, &f, sizeof(f));
+    }
+    bits |= static_cast<uint32_t>(h & 0x8000u) << 16;
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+template <typename T, typename A>
+inline void addRow(A* dst, const T* src, size_t len) {
+    for (size_t i = 0lu; i < len; i++)
+        dst[i] += load(src[i]);
+}
+
+template <typename T, typename A>
+inline void addWeightedRow(A* dst, const T* src, A weight, size_t len) {
+    for (size_t i = 0lu; i < len; i++)
+        dst[i] += load(src[i]) * weight;
+}
+
+// the rows are accumulated in place when the accumulator type matches the table type,
+// otherwise they are accumulated in a thread local buffer and converted on store
+template <typename T, typename A>
+class RowAccumulator {
+public:
+    explicit RowAccumulator(size_t len) : _buffer(len) {}
+
+    A* begin(T*) {
+        std::fill(_buffer.begin(), _buffer.end(), A(0));
+        return _buffer.data();
+    }
+
+    void end(T* dst) {
+        for (size_t i = 0lu; i < _buffer.size(); i++)
+            dst[i] = static_cast<T>(_buffer[i]);
+    }
+
+private:
+    std::vector<A> _buffer;
+};
+
+template <typename T>
+class RowAccumulator<T, T> {
+public:
+    explicit RowAccumulator(size_t len) : _len(len) {}
+
+    T* begin(T* dst) {
+        std::fill(dst, dst + _len, T(0));
+        return dst;
+    }
+
+    void end(T*) {}
+
+private:
+    size_t _len;
+};
+
+// embedding rows are gathered in random order, so the hardware prefetcher can't predict the next one
+constexpr size_t prefetchDistance = 4lu;
+constexpr size_t prefetchMaxBytes = 512lu;
+constexpr size_t cacheLineSize = 64lu;
+
+inline void prefetchRow(const void* row, size_t bytes) {
+    const auto* ptr = reinterpret_cast<const char*>(row);
+    bytes = std::min(bytes, prefetchMaxBytes);
+    for (size_t offset = 0lu; offset < bytes; offset += cacheLineSize) {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(ptr + offset, 0, 3);
+#endif
+    }
+}
+
+}  // namespace
+
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    using A = typename Accumulator<T>::type;
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
     initFromInputs();
@@ -56,63 +210,51 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto *dstData = reinterpret_cast<T *>(outMemory->getData());
 
+    collectBags(outputBagsNum);
+    const size_t totalWork = outputBagsNum ? _bagsWork.back() : 0lu;
+    const size_t tableRows = inDataDims[0];
+    const size_t rowBytes = _embDepth * sizeof(T);
+
     auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        // the bags of the thread are the ones whose work prefix sums fall into its share of the total work
+        auto bagBegin = [&](int i) {
+            const size_t target = totalWork * i / nthr;
+            return static_cast<size_t>(std::upper_bound(_bagsWork.begin(), _bagsWork.end(), target) - _bagsWork.begin());
+        };
+        const size_t start = bagBegin(ithr);
+        const size_t end = bagBegin(ithr + 1);
         if (start >= end)
             return;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        RowAccumulator<T, A> accumulator(_embDepth);
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            const auto& bag = _bags[obi];
+            T* dst = dstData + obi * _embDepth;
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+            // the indices are validated up front to keep the accumulation loops free of checks
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                if (static_cast<size_t>(bag.indices[inIdx]) >= tableRows) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]);
                 }
-                size_t srcIndex = indices[inIdx] * _embDepth;
+            }
 
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
+            for (size_t inIdx = 0lu; inIdx < std::min(prefetchDistance, bag.size); inIdx++)
+                prefetchRow(srcData + bag.indices[inIdx] * _embDepth, rowBytes);
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+            A* acc = accumulator.begin(dst);
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                if (inIdx + prefetchDistance < bag.size)
+                    prefetchRow(srcData + bag.indices[inIdx + prefetchDistance] * _embDepth, rowBytes);
+
+                const T* src = srcData + bag.indices[inIdx] * _embDepth;
+                if (bag.withWeights) {
+                    addWeightedRow(acc, src, static_cast<A>(load(weightsData[bag.weightsIdx + inIdx])), _embDepth);
+                } else {
+                    addRow(acc, src, _embDepth);
                 }
             }
+            accumulator.end(dst);
         }
     };
 
@@ -133,6 +275,14 @@ void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData
         case Precision::U8: {
             return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, inDims, outMemory);
         }
+        case Precision::BF16: {
+            return processData<bfloat16_t>(reinterpret_cast<const bfloat16_t*>(srcData),
+                    reinterpret_cast<const bfloat16_t*>(weightsData), inDims, outMemory);
+        }
+        case Precision::FP16: {
+            return processData<ov::float16>(reinterpret_cast<const ov::float16*>(srcData),
+                    reinterpret_cast<const ov::float16*>(weightsData), inDims, outMemory);
+        }
         case Precision::I32: {
             return processData<PrecisionTrait<Precision::I32>::value_type>(reinterpret_cast<const int32_t*>(srcData),
                     reinterpret_cast<const int32_t*>(weightsData), inDims, outMemory);
@@ -43,6 +43,17 @@ protected:
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
 
+    struct Bag {
+        const int* indices;
+        size_t size;
+        int weightsIdx;
+        bool withWeights;
+    };
+
+    // collects the bags sequentially and computes the prefix sums of their work, so the threads get equal amount
+    // of rows to accumulate rather than equal number of bags
+    void collectBags(size_t outputBagsNum);
+
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
     const size_t PER_SAMPLE_WEIGHTS_IDX;
@@ -51,6 +62,9 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<Bag> _bags;
+    std::vector<size_t> _bagsWork;
 };
 
 }   // namespace node
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -51,11 +52,9 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::FP16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -92,6 +91,19 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->getData());
     }
+
+    // the first index and the size of every segment are found in a single pass over segment ids,
+    // so getIndices doesn't scan all the indices for each segment
+    segmentsFirst_.assign(std::max(lastNumSegments_, 0), -1);
+    segmentsSize_.assign(std::max(lastNumSegments_, 0), 0lu);
+    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
+        const auto segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= lastNumSegments_)
+            continue;
+        if (segmentsFirst_[segmentId] < 0)
+            segmentsFirst_[segmentId] = si;
+        segmentsSize_[segmentId]++;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(size_t embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -99,19 +111,9 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex, const int*& indices, size
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentsSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
-    }
-
     // Empty bag
     if (size == 0) {
         size = 1lu;
@@ -120,6 +122,9 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex, const int*& indices, size
             indices = defaultIndices_;
         return;
     }
+
+    indices = indices_ + segmentsFirst_[embIndex];
+    weightsIdx = segmentsFirst_[embIndex];
 }
 
 int32_t EmbeddingSegmentsSum::getNumSegments() const {
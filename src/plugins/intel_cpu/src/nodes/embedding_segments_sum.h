@@ -47,6 +47,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    std::vector<int> segmentsFirst_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }   // namespace node
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "nodes/executors/transpose.hpp"
 #include "utils/debug_capabilities.h"
 
@@ -24,6 +26,8 @@ private:
     static const impl_desc_type implType = impl_desc_type::acl;
     arm_compute::Tensor srcTensor, dstTensor;
     std::unique_ptr<arm_compute::NEPermute> acl_permute;
+    // the tensors are bound to the user memory on each call and the executor may be shared between streams
+    std::mutex execMutex;
 };
 
 class ACLTransposeExecutorBuilder : public TransposeExecutorBuilder {
@@ -25,6 +25,7 @@
 #include "common/primitive_hashing_utils.hpp"
 #include "common/primitive_desc.hpp"
 #include "common/primitive_desc_iface.hpp"
+#include <cpu/ref_eltwise.hpp>
 
 #include <string>
 #include <vector>
@@ -239,6 +240,10 @@ void FullyConnected::getSupportedDescriptors() {
 
     withBiases = getOriginalInputsNumber() == 3;
 
+    // compressed weights are multiplied by the own gemm, see initSupportedPrimitiveDescriptors
+    if (useWeightsDecompression)
+        return;
+
     useSparseWeights = useSparseWeightsDecompression();
 
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
@@ -366,6 +371,12 @@ void FullyConnected::prepackMLASWeight() {
 #endif
 
 void FullyConnected::createPrimitive() {
+    if (useWeightsDecompression) {
+        Node::createPrimitive();
+        prepareCompressedWeights();
+        initDecompressionPostOps();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         Node::createPrimitive();
@@ -396,9 +407,8 @@ void FullyConnected::prepareParams() {
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
-#ifdef OV_CPU_WITH_MLAS
     // M should be normalized and updated
-    if (useMlas) {
+    if (useMlas || useWeightsDecompression) {
         outDims = dstMemPtr->getStaticDims();
         if (outDims.size() > 2) {
             M = std::accumulate(outDims.begin(), outDims.end() - 1, 1, std::multiplies<size_t>());
@@ -407,7 +417,6 @@ void FullyConnected::prepareParams() {
         }
         return;
     }
-#endif
     DnnlMemoryDescPtr weightDesc = MemoryDescUtils::convertToDnnlMemoryDesc(weightDescIP);
     DnnlMemoryDescCPtr biasDesc = nullptr;
     if (biasMemPtr) {
@@ -563,7 +572,104 @@ void FullyConnected::executeMLAS() {
 
 #endif
 
+void FullyConnected::fuseWeightsDecompression(WeightsDecompressionParam scale, WeightsDecompressionParam zeroPoint) {
+    decompressionScale = std::move(scale);
+    decompressionZeroPoint = std::move(zeroPoint);
+    useWeightsDecompression = true;
+}
+
+void FullyConnected::prepareCompressedWeights() {
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+    const auto& wgtDims = weightsMem->getStaticDims();
+    N = wgtDims[0];
+    K = wgtDims[1];
+
+    // the weights which fit into 4 bits (e.g. U4/I4 weights, which are unpacked to U8/I8 by ConvertPrecision)
+    // are packed back, so the gemm reads half of the memory
+    const auto* weightsData = reinterpret_cast<const uint8_t*>(weightsMem->getData());
+    const auto weightsPrc = weightsMem->getDesc().getPrecision();
+    if (!weights_fit_into_4bit(weightsData, weightsPrc, N * K)) {
+        compressedWeightsPtr = weightsMem;
+        compressedWeightsPrc = weightsPrc;
+        return;
+    }
+
+    compressedWeightsPrc = weightsPrc == Precision::I8 ? Precision::I4 : Precision::U4;
+    auto create = [&]() {
+        MemoryPtr ptr = std::make_shared<Memory>(getEngine(),
+                                                 intel_cpu::CpuBlockedMemoryDesc(Precision::U8, intel_cpu::Shape{N * div_up(K, 2)}));
+        pack_weights_to_4bit(weightsData, reinterpret_cast<uint8_t*>(ptr->getData()), weightsPrc, N, K);
+        return ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_compressed_4bit_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsData));
+        compressedWeightsPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        compressedWeightsPtr = create();
+    }
+}
+
+void FullyConnected::initDecompressionPostOps() {
+    decompressionPostOps.clear();
+    for (const auto& node : fusedWith) {
+        const auto eltwise = std::dynamic_pointer_cast<Eltwise>(node);
+        if (!eltwise)
+            IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << getName()
+                       << " with compressed weights is not supported";
+
+        if (eltwise->getOneDnnAlgorithm() != dnnl::algorithm::undef) {
+            const auto refEltwise = std::make_shared<dnnl::impl::cpu::ref_eltwise_scalar_fwd_t>(
+                static_cast<dnnl_alg_kind_t>(eltwise->getOneDnnAlgorithm()), eltwise->getAlpha(), eltwise->getBeta(), 1.f);
+            decompressionPostOps.emplace_back([refEltwise](float* data, size_t, size_t count) {
+                for (size_t i = 0; i < count; i++)
+                    data[i] = refEltwise->compute_scalar(data[i]);
+            });
+            continue;
+        }
+
+        // scales and shifts are per tensor or per output channel, they are filled when the eltwise is fused
+        const auto& scales = eltwise->getScales();
+        const auto& shifts = eltwise->getShifts();
+        if (scales.empty() || shifts.empty())
+            IE_THROW() << "Eltwise node " << eltwise->getName() << " fused into " << getName() << " has no scales and shifts";
+        decompressionPostOps.emplace_back([scales, shifts](float* data, size_t n0, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                const size_t n = n0 + i;
+                data[i] = data[i] * scales[scales.size() == 1 ? 0 : n] + shifts[shifts.size() == 1 ? 0 : n];
+            }
+        });
+    }
+}
+
+void FullyConnected::executeWithWeightsDecompression() {
+    const auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto biasMemPtr = withBiases ? getParentEdgeAt(BIAS_ID)->getMemoryPtr() : nullptr;
+    weights_decompression_gemm(srcMemPtr->getData(),
+                               srcMemPtr->getDesc().getPrecision(),
+                               reinterpret_cast<const uint8_t*>(compressedWeightsPtr->getData()),
+                               compressedWeightsPrc,
+                               decompressionScale,
+                               decompressionZeroPoint,
+                               withBiases ? reinterpret_cast<const float*>(biasMemPtr->getData()) : nullptr,
+                               dstMemPtr->getData(),
+                               dstMemPtr->getDesc().getPrecision(),
+                               M,
+                               N,
+                               K,
+                               decompressionPostOps);
+}
+
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useWeightsDecompression) {
+        executeWithWeightsDecompression();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         executeMLAS();
@@ -599,6 +705,10 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the gemm with compressed weights applies the unary and per channel scale shift eltwise post ops only
+    if (useWeightsDecompression)
+        return node->getType() == Type::Eltwise && node->getAlgorithm() != Algorithm::EltwisePrelu &&
+               canFuseSimpleOperation(node);
     return canFuseSimpleOperation(node);
 }
 
@@ -784,6 +894,22 @@ void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDes
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
+    if (useWeightsDecompression) {
+        // the gemm accumulates in FP32 and reads / writes FP32 or BF16 data, so the inference precision is kept
+        auto dataPrecision = getOriginalInputPrecisionAtPort(DATA_ID);
+        auto outputPrecision = fusedWith.empty() ? getOriginalOutputPrecisionAtPort(0)
+                                                 : fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+        if (dataPrecision != Precision::BF16)
+            dataPrecision = Precision::FP32;
+        if (outputPrecision != Precision::BF16)
+            outputPrecision = Precision::FP32;
+        std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, dataPrecision},
+                                                 {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.push_back({LayoutType::ncsp, Precision::FP32});
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, outputPrecision}}, impl_desc_type::gemm_any);
+        return;
+    }
     if (useMlas) {
         auto dataPrecision = getOriginalInputPrecisionAtPort(0);
         if (withBiases) {
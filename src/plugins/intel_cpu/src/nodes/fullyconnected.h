@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "common/weights_decompression_gemm.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -57,6 +58,13 @@ public:
     void executeDynamicImpl(dnnl::stream strm) override;
     bool canBeExecutedInInt8() const override;
 
+    /**
+     * @brief Keeps the U8/I8 weights compressed, they are decompressed on the fly as (w - zeroPoint) * scale
+     * @param zeroPoint
+     * may be empty
+     */
+    void fuseWeightsDecompression(WeightsDecompressionParam scale, WeightsDecompressionParam zeroPoint);
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -101,12 +109,23 @@ private:
     bool useSparseWeightsDecompression();
     VectorDims expectedBiasDims {};
     bool useMlas = false;
-#ifdef OV_CPU_WITH_MLAS
     int64_t M, N, K;
+#ifdef OV_CPU_WITH_MLAS
     MemoryPtr mlasPackedPtr = nullptr;
     void executeMLAS();
     void prepackMLASWeight();
 #endif
+
+    // weights decompression
+    bool useWeightsDecompression = false;
+    WeightsDecompressionParam decompressionScale;
+    WeightsDecompressionParam decompressionZeroPoint;
+    MemoryCPtr compressedWeightsPtr = nullptr;
+    InferenceEngine::Precision compressedWeightsPrc;
+    std::vector<WeightsDecompressionPostOp> decompressionPostOps;
+    void prepareCompressedWeights();
+    void initDecompressionPostOps();
+    void executeWithWeightsDecompression();
 };
 
 }   // namespace node
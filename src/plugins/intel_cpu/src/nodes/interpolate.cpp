@@ -2801,6 +2801,7 @@ void Interpolate::InterpolateJitExecutor::pillowCGathered(const uint8_t *in_ptr_
     // workBuffer needed when both pass are true
     bool xPass = IW != OW;
     bool yPass = IH != OH;
+    std::vector<uint8_t> pillow_working_buf(xPass && yPass ? getPillowWorkingBufSize() : 0);
 
     parallel_for(B, [&](size_t b) {
         auto arg = jit_interpolate_call_args();
@@ -3667,6 +3668,7 @@ void Interpolate::InterpolateRefExecutor::pillowRef(const uint8_t *in_ptr_, uint
     // workBuffer needed when both pass is true
     bool xPass = IW != OW;
     bool yPass = IH != OH;
+    std::vector<uint8_t> pillow_working_buf(xPass && yPass ? getPillowWorkingBufSize() : 0);
 
     // --------    ----
     // |      |    |  |
@@ -3745,12 +3747,13 @@ void Interpolate::InterpolateRefExecutor::pillowRef(const uint8_t *in_ptr_, uint
     });
 }
 
-void Interpolate::InterpolateExecutorBase::create_pillow_working_buf(InterpolateLayoutType layout) {
+// the working buffer is allocated per call, as the executor may be shared between streams
+size_t Interpolate::InterpolateExecutorBase::getPillowWorkingBufSize() const {
     if (srcDimPad5d[3] == dstDim5d[3] || srcDimPad5d[4] == dstDim5d[4])
-        return;
+        return 0;
     size_t bufSize = srcDimPad5d[3] * dstDim5d[4] * srcDataSize; // IH * OW
     size_t threadsNum = parallel_get_num_threads();
-    if (layout == InterpolateLayoutType::planar) {
+    if (configured_for_layout == InterpolateLayoutType::planar) {
         // B and C execute in parallel, need separate buf
         size_t parallelNum = srcDimPad5d[0] * srcDimPad5d[1];
         bufSize *= std::min(threadsNum, parallelNum);
@@ -3760,7 +3763,7 @@ void Interpolate::InterpolateExecutorBase::create_pillow_working_buf(Interpolate
         size_t parallelNum = srcDimPad5d[0];
         bufSize *= std::min(threadsNum, parallelNum);
     }
-    pillow_working_buf.resize(bufSize);
+    return bufSize;
 }
 
 Interpolate::InterpolateExecutorBase::InterpolateExecutorBase(const InterpolateAttrs& interpAttrs,
@@ -3797,9 +3800,6 @@ Interpolate::InterpolateExecutorBase::InterpolateExecutorBase(const InterpolateA
         case InterpolateMode::bilinear_pillow:
         case InterpolateMode::bicubic_pillow: {
             buildTblPillow(srcDimPad5d, dstDim5d, dataScales, interpAttrs.cubeCoeff, interpAttrs.layout);
-            if ((srcDimPad5d[4] != dstDim5d[4]) && (srcDimPad5d[3] != dstDim5d[3])) {
-                create_pillow_working_buf(interpAttrs.layout);
-            }
             break;
         }
         default: {
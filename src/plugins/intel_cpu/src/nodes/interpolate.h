@@ -140,9 +140,10 @@ private:
             std::vector<float> getCubicCoeffs(float mantissa, float a);
             static float getPillowBilinearCoeffs(float m);
             static float getPillowBicubicCoeffs(float m);
-            inline void create_pillow_working_buf(InterpolateLayoutType layout);
 
         protected:
+            size_t getPillowWorkingBufSize() const;
+
             InterpolateMode mode;
             InterpolateCoordTransMode coordTransMode;
             InterpolateLayoutType configured_for_layout;
@@ -152,7 +153,6 @@ private:
             int spatialDimSize;
             size_t dataRank;
             std::vector<int> auxTable;
-            std::vector<uint8_t> pillow_working_buf;
     };
     std::shared_ptr<InterpolateExecutorBase> execPtr = nullptr;
 
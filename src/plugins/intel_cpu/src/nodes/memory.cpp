@@ -124,6 +124,7 @@ void MemoryInput::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->nullify();
+    inputStore = outputStore = dataStore;
 }
 
 /**
@@ -157,18 +158,65 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::bindStore(const MemoryPtr& input, const MemoryPtr& output) {
+    inputStore = input ? input : dataStore;
+    outputStore = output ? output : inputStore;
+}
+
 void MemoryInput::storeState(const IMemory &new_state) {
     // TODO: Should be next one call:
-    //           dataStore.load(new_state, false);
+    //           outputStore.load(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*outputStore, new_state);
+}
+
+bool MemoryInput::canShareStoreMemory() {
+    if (storeSharing == StoreSharing::Unknown) {
+        storeSharing = StoreSharing::Possible;
+        // the same checks as for the graph inputs: the state must not be modified by the consumers
+        for (auto& edge : getChildEdges()) {
+            auto childEdge = edge.lock();
+            if (!childEdge)
+                IE_THROW() << "Node " << getName() << " contains empty child edge";
+            auto& child = childEdge->getChild();
+            if (child->isConstant() || childEdge->inPlace(Edge::LOOK_DOWN) || childEdge->modifiedInPlace() ||
+                (child->getType() == Type::Concatenation && child->isInPlace()) ||
+                childEdge->getMemory().getDesc().getPrecision() != dataStore->getDesc().getPrecision() ||
+                childEdge->getMemory().getSize() != dataStore->getSize()) {
+                storeSharing = StoreSharing::Impossible;
+                break;
+            }
+        }
+    }
+    return storeSharing == StoreSharing::Possible;
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    // the state is passed to the consumers as is, unless it is overwritten by the new state during the inference
+    if (inputStore != outputStore && canShareStoreMemory()) {
+        if (dstMemory.getData() != inputStore->getData()) {
+            if (!graphBuffer) {
+                graphBuffer = dstMemory.getMemoryMngr()->getRawPtr();
+                graphBufferSize = dstMemory.getSize();
+            }
+            for (auto& edge : getChildEdges()) {
+                edge.lock()->getMemory().getMemoryMngr()->setExtBuff(inputStore->getData(), inputStore->getSize());
+            }
+        }
+        return;
+    }
+
+    if (graphBuffer) {
+        for (auto& edge : getChildEdges()) {
+            edge.lock()->getMemory().getMemoryMngr()->setExtBuff(graphBuffer, graphBufferSize);
+        }
+        graphBuffer = nullptr;
+    }
     // TODO: Should be simple call of:
-    //           dst_mem.load(dataStore, false);
+    //           dst_mem.load(inputStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *inputStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -103,8 +103,22 @@ public:
     void setInputNode(Node* node) override {}
     void storeState(const IMemory& mem);
     MemoryPtr getStore();
+    /**
+     * @brief Binds the state storage of the infer request: the state is read from the input memory and the new state
+     * is stored to the output memory. If they differ, the state is passed to the consumers without a copy when possible.
+     */
+    void bindStore(const MemoryPtr& input, const MemoryPtr& output);
  private:
+    bool canShareStoreMemory();
+
     MemoryPtr dataStore;
+    MemoryPtr inputStore;
+    MemoryPtr outputStore;
+    // the output memory buffer allocated by the graph, restored if the state memory can't be shared
+    void* graphBuffer = nullptr;
+    size_t graphBufferSize = 0;
+    enum class StoreSharing { Unknown, Possible, Impossible };
+    StoreSharing storeSharing = StoreSharing::Unknown;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -699,6 +699,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::device::id.name()),
                                                     RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                     RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                    RW_property(ov::intel_cpu::shared_streams_cache.name()),
+                                                    RW_property(ov::intel_cpu::sticky_streams.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -741,6 +743,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::shared_streams_cache) {
+        return decltype(ov::intel_cpu::shared_streams_cache)::value_type(engConfig.sharedStreamsCache);
+    } else if (name == ov::intel_cpu::sticky_streams) {
+        return decltype(ov::intel_cpu::sticky_streams)::value_type(engConfig.stickyStreams);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -805,6 +811,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
+    auto repackedWeights = deserializer.readRepackedWeights();
 
     Config conf = engConfig;
     conf.readProperties(config);
@@ -813,7 +820,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CalculateStreams(conf, function, true);
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), repackedWeights);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -2,11 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "serialize.h"
+#include "graph.h"
+#include "utils/general_utils.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <openvino/util/mmap_object.hpp>
+#include <common/utils.hpp>
 
 #include <pugixml.hpp>
 
+#include <tuple>
+
 using namespace InferenceEngine;
 
 namespace ov {
@@ -41,6 +47,60 @@ namespace {
         IE_THROW(NetworkNotRead) << "Unknown layout with name '" << name << "'";
     }
 
+    // Exposes a part of the mapped cache blob as a blob memory, keeping the mapping alive
+    class MappedMemoryAllocator : public InferenceEngine::IAllocator {
+    public:
+        MappedMemoryAllocator(std::shared_ptr<ov::MappedMemory> memory, size_t offset)
+            : _memory(std::move(memory)), _offset(offset) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle;
+        }
+
+        void unlock(void*) noexcept override {}
+
+        void* alloc(size_t) noexcept override {
+            return _memory->data() + _offset;
+        }
+
+        bool free(void*) noexcept override {
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ov::MappedMemory> _memory;
+        size_t _offset;
+    };
+
+    // Repacked weights section layout:
+    //   [ magic | size of the rest of the section | ISA | entries number ]
+    //   entries number of [ node name | format | size | padding up to the alignment | data ]
+    constexpr uint64_t repackedWeightsMagic = 0x5354484757435052ull;  // "RPCWGHTS"
+    constexpr size_t repackedWeightsAlignment = 64;
+
+    template <typename T>
+    void writeValue(std::ostream& stream, const T& value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void writeString(std::ostream& stream, const std::string& str) {
+        writeValue<uint64_t>(stream, str.size());
+        stream.write(str.c_str(), str.size());
+    }
+
+    template <typename T>
+    bool readValue(std::istream& stream, T& value) {
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+
+    bool readString(std::istream& stream, std::string& str, size_t maxSize) {
+        uint64_t size = 0;
+        if (!readValue(stream, size) || size > maxSize)
+            return false;
+        str.resize(size);
+        return static_cast<bool>(stream.read(&str[0], size));
+    }
+
     template <typename T>
     void setInfo(pugi::xml_object_range<pugi::xml_named_node_iterator>&& nodes, T&& info) {
         auto nodes_it = nodes.begin();
@@ -119,6 +179,40 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
+void CNNNetworkSerializer::writeRepackedWeights(const Graph & graph) {
+    std::vector<std::tuple<const std::string&, const std::string&, MemoryPtr>> weights;
+    for (const auto& node : graph.GetNodes()) {
+        for (const auto& repacked : node->getRepackedWeights()) {
+            weights.emplace_back(node->getName(), repacked.first, repacked.second);
+        }
+    }
+
+    // the section size is written up front, so the reader can skip the section it fails to use
+    const size_t sectionBegin = static_cast<size_t>(_ostream.tellp()) + 2 * sizeof(uint64_t);
+    size_t sectionEnd = sectionBegin + 2 * sizeof(uint64_t);
+    for (const auto& entry : weights) {
+        sectionEnd += 3 * sizeof(uint64_t) + std::get<0>(entry).size() + std::get<1>(entry).size();
+        sectionEnd = rnd_up(sectionEnd, repackedWeightsAlignment) + std::get<2>(entry)->getSize();
+    }
+
+    writeValue<uint64_t>(_ostream, repackedWeightsMagic);
+    writeValue<uint64_t>(_ostream, sectionEnd - sectionBegin);
+    writeValue<uint64_t>(_ostream, static_cast<uint64_t>(dnnl::get_effective_cpu_isa()));
+    writeValue<uint64_t>(_ostream, weights.size());
+
+    const char padding[repackedWeightsAlignment] = {};
+    for (const auto& entry : weights) {
+        const auto& memory = std::get<2>(entry);
+        writeString(_ostream, std::get<0>(entry));
+        writeString(_ostream, std::get<1>(entry));
+        writeValue<uint64_t>(_ostream, memory->getSize());
+        // the data is aligned in the stream, so it is also aligned being mapped to memory
+        const size_t position = _ostream.tellp();
+        _ostream.write(padding, rnd_up(position, repackedWeightsAlignment) - position);
+        _ostream.write(static_cast<const char*>(memory->getData()), memory->getSize());
+    }
+}
+
 CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
     : _istream(istream)
     , _cnn_network_builder(fn) {
@@ -146,10 +240,22 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc constsDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        auto mmapStream = dynamic_cast<ov::MmapStream*>(&_istream);
+        if (mmapStream && mmapStream->memory()) {
+            // the cache blob is mapped, so the constants refer to the mapped pages instead of being copied
+            const auto& memory = mmapStream->memory();
+            if (hdr.consts_offset + hdr.consts_size > memory->size()) {
+                IE_THROW(NetworkNotRead) << "The constants section is out of the model blob bounds.";
+            }
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                constsDesc, std::make_shared<MappedMemoryAllocator>(memory, hdr.consts_offset));
+            dataBlob->allocate();
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(constsDesc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -168,5 +274,75 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setInfo(outputs.children("out"), network.getOutputsInfo());
 }
 
+RepackedWeights::CPtr CNNNetworkDeserializer::readRepackedWeights() {
+    const auto sectionPosition = _istream.tellg();
+    uint64_t magic = 0, sectionSize = 0;
+    if (!readValue(_istream, magic) || magic != repackedWeightsMagic || !readValue(_istream, sectionSize)) {
+        // there is no section, the stream is left as it was
+        _istream.clear();
+        _istream.seekg(sectionPosition);
+        return nullptr;
+    }
+    const size_t sectionEnd = static_cast<size_t>(_istream.tellg()) + sectionSize;
+
+    auto repackedWeights = readRepackedWeightsEntries(sectionEnd);
+    // the stream is always positioned after the section, whether it was used or not
+    _istream.clear();
+    if (!_istream.seekg(sectionEnd)) {
+        // the section is truncated
+        _istream.clear();
+        _istream.seekg(0, std::ios::end);
+    }
+    return repackedWeights;
+}
+
+RepackedWeights::CPtr CNNNetworkDeserializer::readRepackedWeightsEntries(size_t sectionEnd) {
+    uint64_t isa = 0, entriesNum = 0;
+    if (!readValue(_istream, isa) || !readValue(_istream, entriesNum)) {
+        return nullptr;
+    }
+    // the repacked weights may depend on the instruction set (e.g. the int8 weights scaling)
+    if (isa != static_cast<uint64_t>(dnnl::get_effective_cpu_isa()) || entriesNum == 0) {
+        return nullptr;
+    }
+
+    std::shared_ptr<ov::MappedMemory> mappedMemory;
+    if (auto mmapStream = dynamic_cast<ov::MmapStream*>(&_istream))
+        mappedMemory = mmapStream->memory();
+    if (mappedMemory && sectionEnd > mappedMemory->size()) {
+        return nullptr;
+    }
+
+    auto repackedWeights = std::make_shared<RepackedWeights>();
+    for (uint64_t i = 0; i < entriesNum; i++) {
+        std::string nodeName, format;
+        uint64_t size = 0;
+        if (!readString(_istream, nodeName, sectionEnd) || !readString(_istream, format, sectionEnd) ||
+            !readValue(_istream, size)) {
+            return nullptr;
+        }
+        const size_t position = _istream.tellg();
+        const size_t dataOffset = rnd_up(position, repackedWeightsAlignment);
+        if (dataOffset > sectionEnd || size > sectionEnd - dataOffset) {
+            return nullptr;
+        }
+
+        if (mappedMemory) {
+            // refer to the mapped pages instead of copying the data
+            repackedWeights->add(nodeName, format, mappedMemory->data() + dataOffset, size, mappedMemory);
+            _istream.seekg(dataOffset + size);
+        } else {
+            std::shared_ptr<void> data(dnnl::impl::malloc(size, repackedWeightsAlignment), dnnl::impl::free);
+            _istream.seekg(dataOffset);
+            if (!data || !_istream.read(static_cast<char*>(data.get()), size)) {
+                return nullptr;
+            }
+            repackedWeights->add(nodeName, format, data.get(), size, data);
+        }
+    }
+
+    return repackedWeights;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
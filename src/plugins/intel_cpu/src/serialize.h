@@ -3,6 +3,7 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "weights_cache.hpp"
 
 #include <iostream>
 #include <functional>
@@ -11,10 +12,14 @@
 namespace ov {
 namespace intel_cpu {
 
+class Graph;
+
 class CNNNetworkSerializer {
 public:
     CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
     void operator << (const InferenceEngine::CNNNetwork & network);
+    // writes the weights repacked by the graph nodes, must follow the network
+    void writeRepackedWeights(const Graph & graph);
 
 private:
     std::ostream & _ostream;
@@ -29,8 +34,13 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    // reads the weights repacked by the exported graph, must follow the network
+    // returns nullptr if there are no repacked weights or they are not applicable on the current machine
+    RepackedWeights::CPtr readRepackedWeights();
 
 private:
+    RepackedWeights::CPtr readRepackedWeightsEntries(size_t sectionEnd);
+
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
 };
@@ -4,6 +4,7 @@
 
 #include "transformations/cpu_opset/common/op/fully_connected.hpp"
 #include "convert_matmul_to_fc.hpp"
+#include "mark_fc_weights_decompression.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -14,7 +15,10 @@
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Convert>(ngraph::pattern::has_static_rank());
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant,
+                                                ngraph::opset1::Convert,
+                                                ngraph::opset1::Multiply,
+                                                ngraph::opset1::Reshape>(ngraph::pattern::has_static_rank());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -37,6 +41,10 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
             } else {
                 return false;
             }
+        } else if (!ngraph::is_type<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) &&
+                   !is_fc_weights_decompression(fc_input_b.get_node_shared_ptr())) {
+            // the decompressed INT8/INT4 weights are kept as is, FullyConnected decompresses them on the fly
+            return false;
         }
 
         auto shape_a = fc_input_a.get_partial_shape();
@@ -0,0 +1,184 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_fc_weights_decompression.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "itt.hpp"
+#include "utils/general_utils.h"
+
+namespace {
+
+bool is_constant_param(const std::shared_ptr<ov::Node>& param) {
+    auto node = param;
+    if (ov::is_type<ngraph::opset1::Convert>(node))
+        node = node->get_input_node_shared_ptr(0);
+    return ov::is_type<ngraph::opset1::Constant>(node) && param->get_output_partial_shape(0).is_static();
+}
+
+// the scale or the zero point must be per output channel or per group of input channels,
+// so it changes along the outer dims of the weights only
+bool is_supported_param_shape(const ov::Shape& shape, const ov::Shape& weights_shape) {
+    // scalars are converted to PowerStatic, which is not fused into FullyConnected
+    if (ov::shape_size(shape) <= 1 || shape.size() > weights_shape.size())
+        return false;
+
+    ov::Shape normalized(weights_shape.size() - shape.size(), 1);
+    normalized.insert(normalized.end(), shape.begin(), shape.end());
+    if (normalized[0] != 1 && normalized[0] != weights_shape[0])
+        return false;
+
+    size_t i = 1;
+    while (i < normalized.size() && normalized[i] == weights_shape[i])
+        i++;
+    return std::all_of(normalized.begin() + i, normalized.end(), [](size_t dim) { return dim == 1; });
+}
+
+// transposes the constant path of the rank 2 (after unsqueeze) weights decompression input
+ov::Output<ov::Node> transpose_2d(const ov::Output<ov::Node>& output) {
+    auto shape = output.get_shape();
+    shape.insert(shape.begin(), 2 - shape.size(), 1);
+    auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, shape);
+    auto reshape = ov::op::util::make_try_fold<ngraph::opset1::Reshape>(output, reshape_const, false);
+    auto transpose_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 0});
+    return ov::op::util::make_try_fold<ngraph::opset1::Transpose>(reshape, transpose_const);
+}
+
+}  // namespace
+
+ov::intel_cpu::MarkFCWeightsDecompression::MarkFCWeightsDecompression() {
+    MATCHER_SCOPE(MarkFCWeightsDecompression);
+    auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply, ngraph::opset1::Reshape>(ngraph::pattern::has_static_shape());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        if (!matmul || transformation_callback(matmul))
+            return false;
+
+        // FullyConnected supports 2D and 3D activations only
+        const auto rank_a = pattern_map.at(activations_m).get_partial_shape().rank().get_length();
+        if (rank_a < 2 || rank_a > 3)
+            return false;
+
+        std::shared_ptr<ov::Node> reshape;
+        auto multiply = pattern_map.at(weights_m).get_node_shared_ptr();
+        if (ov::is_type<ngraph::opset1::Reshape>(multiply)) {
+            reshape = multiply;
+            multiply = reshape->get_input_node_shared_ptr(0);
+            if (!ov::is_type<ngraph::opset1::Constant>(reshape->get_input_node_shared_ptr(1)))
+                return false;
+        }
+        if (!ov::is_type<ngraph::opset1::Multiply>(multiply) || multiply->get_output_target_inputs(0).size() != 1)
+            return false;
+
+        std::shared_ptr<ov::Node> subtract;
+        auto convert = multiply->get_input_node_shared_ptr(0);
+        if (ov::is_type<ngraph::opset1::Subtract>(convert)) {
+            subtract = convert;
+            convert = subtract->get_input_node_shared_ptr(0);
+            if (subtract->get_output_target_inputs(0).size() != 1 || !is_constant_param(subtract->get_input_node_shared_ptr(1)))
+                return false;
+        }
+        if (!ov::is_type<ngraph::opset1::Convert>(convert) || convert->get_output_target_inputs(0).size() != 1 ||
+            !is_constant_param(multiply->get_input_node_shared_ptr(1)))
+            return false;
+
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+        if (!weights || !one_of(weights->get_element_type(), ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4))
+            return false;
+
+        // the decompressed weights must be [N, K], as FullyConnected reads the compressed weights row by row
+        auto weights_shape = weights->get_shape();
+        if (reshape) {
+            const auto& fc_weights_shape = reshape->get_output_shape(0);
+            if (!matmul->get_transpose_b() || fc_weights_shape.size() != 2 || weights_shape.size() < 2 ||
+                fc_weights_shape[0] != weights_shape[0])
+                return false;
+        } else if (weights_shape.size() != 2 || multiply->get_output_shape(0).size() != 2) {
+            return false;
+        }
+
+        auto scale_shape = multiply->get_input_shape(1);
+        auto zero_point_shape = subtract ? subtract->get_input_shape(1) : ov::Shape{};
+        std::shared_ptr<ov::Node> new_weights;
+        if (!matmul->get_transpose_b()) {
+            // the packed INT4 constants can't be transposed element by element
+            if (weights->get_element_type().bitwidth() != 8)
+                return false;
+            new_weights = transpose_2d(weights).get_node_shared_ptr();
+            if (!ov::is_type<ngraph::opset1::Constant>(new_weights))
+                return false;
+            std::swap(weights_shape[0], weights_shape[1]);
+            scale_shape.insert(scale_shape.begin(), 2 - scale_shape.size(), 1);
+            std::swap(scale_shape[0], scale_shape[1]);
+            if (subtract) {
+                zero_point_shape.insert(zero_point_shape.begin(), 2 - zero_point_shape.size(), 1);
+                std::swap(zero_point_shape[0], zero_point_shape[1]);
+            }
+        }
+
+        if (!is_supported_param_shape(scale_shape, weights_shape) ||
+            (subtract && !is_supported_param_shape(zero_point_shape, weights_shape)))
+            return false;
+
+        if (new_weights) {
+            ngraph::NodeVector old_ops{weights, convert, multiply};
+            ngraph::NodeVector new_ops{new_weights};
+            auto new_convert = convert->clone_with_new_inputs({new_weights});
+            new_ops.push_back(new_convert);
+            std::shared_ptr<ov::Node> new_data = new_convert;
+            if (subtract) {
+                new_data = subtract->clone_with_new_inputs({new_data, transpose_2d(subtract->input_value(1))});
+                new_data->set_friendly_name(subtract->get_friendly_name());
+                old_ops.push_back(subtract);
+                new_ops.push_back(new_data);
+                subtract = new_data;
+            }
+            auto new_multiply = multiply->clone_with_new_inputs({new_data, transpose_2d(multiply->input_value(1))});
+            new_multiply->set_friendly_name(multiply->get_friendly_name());
+            new_ops.push_back(new_multiply);
+
+            new_weights->set_friendly_name(weights->get_friendly_name());
+            new_convert->set_friendly_name(convert->get_friendly_name());
+            ngraph::copy_runtime_info(old_ops, new_ops);
+            matmul->input(1).replace_source_output(new_multiply);
+            matmul->set_transpose_b(true);
+            convert = new_convert;
+            multiply = new_multiply;
+        }
+
+        disable_constant_folding(convert);
+        if (subtract)
+            mark_as_dequantization_node(subtract);
+        mark_as_dequantization_node(multiply);
+
+        return new_weights != nullptr;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+bool ov::intel_cpu::is_fc_weights_decompression(const std::shared_ptr<ov::Node>& node) {
+    auto multiply = node;
+    if (ov::is_type<ngraph::opset1::Reshape>(multiply))
+        multiply = multiply->get_input_node_shared_ptr(0);
+    if (!ov::is_type<ngraph::opset1::Multiply>(multiply) || !is_dequantization_node(multiply))
+        return false;
+
+    auto convert = multiply->get_input_node_shared_ptr(0);
+    if (ov::is_type<ngraph::opset1::Subtract>(convert))
+        convert = convert->get_input_node_shared_ptr(0);
+    return ov::is_type<ngraph::opset1::Convert>(convert) &&
+           ov::is_type<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+}
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Keeps the decompression subgraph of the INT8/INT4 MatMul weights unfolded, so the CPU plugin fuses it
+ *     into FullyConnected and the weights stay compressed in memory:
+ *
+ *     Constant(u8/i8/u4/i4) -> Convert -> [Subtract(zero point)] -> Multiply(scale) -> [Reshape] -> MatMul
+ *
+ *     The scale and the zero point must be per output channel or per group of input channels.
+ *     The weights which are not transposed are transposed in place, so the subgraph produces [N, K] weights.
+ *     The transformation callback is called for the MatMul, so the plugin can keep the subgraph foldable
+ *     for the shapes where the decompressing gemm doesn't pay off.
+ */
+class MarkFCWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkFCWeightsDecompression", "0");
+    MarkFCWeightsDecompression();
+};
+
+/**
+ * @brief Checks whether the node is the output of the weights decompression subgraph marked by MarkFCWeightsDecompression
+ */
+bool is_fc_weights_decompression(const std::shared_ptr<ov::Node>& node);
+
+}   // namespace intel_cpu
+}   // namespace ov
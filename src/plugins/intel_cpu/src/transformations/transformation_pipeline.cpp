@@ -107,6 +107,7 @@
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/mark_fc_weights_decompression.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -204,6 +205,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::InitNodeInfo);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkShapeOfSubgraphs);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompressionForMatMul);
+    CPU_REGISTER_PASS_COMMON(manager, MarkFCWeightsDecompression);
 
     const bool useLpt = !defaultPrecisions.empty();
     if (useLpt) {
@@ -335,6 +337,25 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
             },
         ov::pass::SoftmaxDecomposition);
 
+    CPU_SET_CALLBACK_COMMON(manager,
+        [](const_node_ptr &node) -> bool {
+            // The gemm with compressed weights is bound by the weights bandwidth, so it outperforms oneDNN only
+            // when few source rows reuse the weights (e.g. LLM token generation). Quantized activations are left to LPT.
+            constexpr int64_t maxRows = 16;
+            if (ov::is_type<ov::opset1::FakeQuantize>(node->get_input_node_ptr(0)))
+                return true;
+            const auto matmul = ov::as_type<const ov::opset1::MatMul>(node.get());
+            const auto& shape = node->get_input_partial_shape(0);
+            const size_t kAxis = matmul && matmul->get_transpose_a() ? shape.size() - 2 : shape.size() - 1;
+            ov::Dimension rows = 1;
+            for (size_t i = 0; i < shape.size(); i++) {
+                if (i != kAxis)
+                    rows *= shape[i];
+            }
+            return rows.is_static() && rows.get_length() > maxRows;
+        },
+        MarkFCWeightsDecompression);
+
     // NMS-alike nodes are always transformed to NMSIEInternal node in case of legacy api, for compatibility.
     // And on the other hand in case of api 2.0, keep them internal dynamic for better performance and functionality.
     auto nmsCallback = [isLegacyApi](const_node_ptr &node) -> bool {
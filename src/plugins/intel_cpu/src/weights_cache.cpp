@@ -5,11 +5,128 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+
+#include <array>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+// reflected ECMA-182 polynomial
+constexpr uint64_t crcPoly = 0xc96c5795d7870f42;
+
+// each item is the image of the corresponding bit of the crc register, so the matrix is a linear operator over GF(2)
+using Gf2Matrix = std::array<uint64_t, 64>;
+
+uint64_t gf2MatrixTimes(const Gf2Matrix& mat, uint64_t vec) {
+    uint64_t sum = 0;
+    for (size_t i = 0; vec; ++i, vec >>= 1) {
+        if (vec & 1)
+            sum ^= mat[i];
+    }
+    return sum;
+}
+
+Gf2Matrix gf2MatrixMultiply(const Gf2Matrix& lhs, const Gf2Matrix& rhs) {
+    Gf2Matrix result;
+    for (size_t i = 0; i < result.size(); ++i)
+        result[i] = gf2MatrixTimes(lhs, rhs[i]);
+    return result;
+}
+
+/**
+ * Returns the operator which updates the crc register with len zero bytes. Since the crc register is updated linearly,
+ * crc(A + B) = zeroBytesOperator(size(B)) * crc(A) ^ crc(B), that allows to compute crc of the chunks independently.
+ */
+Gf2Matrix zeroBytesOperator(size_t len) {
+    Gf2Matrix op;
+    // the operator for one zero bit
+    op[0] = crcPoly;
+    for (size_t i = 1; i < op.size(); ++i)
+        op[i] = 1ull << (i - 1);
+    // the operator for one zero byte
+    for (int i = 0; i < 3; ++i)
+        op = gf2MatrixMultiply(op, op);
+
+    Gf2Matrix result;
+    for (size_t i = 0; i < result.size(); ++i)
+        result[i] = 1ull << i;
+
+    while (len) {
+        if (len & 1)
+            result = gf2MatrixMultiply(op, result);
+        len >>= 1;
+        if (len)
+            op = gf2MatrixMultiply(op, op);
+    }
+    return result;
+}
+
+inline uint64_t loadLE64(const unsigned char* data) {
+    return static_cast<uint64_t>(data[0]) | static_cast<uint64_t>(data[1]) << 8 |
+           static_cast<uint64_t>(data[2]) << 16 | static_cast<uint64_t>(data[3]) << 24 |
+           static_cast<uint64_t>(data[4]) << 32 | static_cast<uint64_t>(data[5]) << 40 |
+           static_cast<uint64_t>(data[6]) << 48 | static_cast<uint64_t>(data[7]) << 56;
+}
+}  // namespace
+
+SimpleDataHash::SimpleDataHash() {
+    for (int i = 0; i < kTableSize; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? crcPoly : 0) ^ (c >> 1);
+        table[0][i] = c;
+    }
+    for (int i = 0; i < kTableSize; i++) {
+        for (int k = 1; k < kSlicesNum; k++)
+            table[k][i] = table[0][table[k - 1][i] & 0xff] ^ (table[k - 1][i] >> 8);
+    }
+}
+
+uint64_t SimpleDataHash::update(uint64_t crc, const unsigned char* data, size_t size) const {
+    for (; size >= kSlicesNum; size -= kSlicesNum, data += kSlicesNum) {
+        crc ^= loadLE64(data);
+        crc = table[7][crc & 0xff] ^ table[6][(crc >> 8) & 0xff] ^
+              table[5][(crc >> 16) & 0xff] ^ table[4][(crc >> 24) & 0xff] ^
+              table[3][(crc >> 32) & 0xff] ^ table[2][(crc >> 40) & 0xff] ^
+              table[1][(crc >> 48) & 0xff] ^ table[0][crc >> 56];
+    }
+    for (; size; --size, ++data)
+        crc = table[0][(crc ^ *data) & 0xff] ^ (crc >> 8);
+    return crc;
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    // the chunks must be large enough to hide the combination cost
+    constexpr size_t minChunkSize = 1 << 20;
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    if (nthr == 1 || size < 2 * minChunkSize)
+        return ~update(0, data, size);
+
+    const size_t chunksNum = std::min(size / minChunkSize, 4 * nthr);
+    const size_t chunkSize = div_up(size, chunksNum);
+    const size_t lastChunkSize = size - (chunksNum - 1) * chunkSize;
+
+    std::vector<uint64_t> crcs(chunksNum);
+    parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * chunkSize;
+        crcs[i] = update(0, data + offset, std::min(chunkSize, size - offset));
+    });
+
+    const auto chunkOp = zeroBytesOperator(chunkSize);
+    uint64_t crc = crcs[0];
+    for (size_t i = 1; i < chunksNum - 1; ++i)
+        crc = gf2MatrixTimes(chunkOp, crc) ^ crcs[i];
+    const auto lastChunkOp = lastChunkSize == chunkSize ? chunkOp : zeroBytesOperator(lastChunkSize);
+    crc = gf2MatrixTimes(lastChunkOp, crc) ^ crcs[chunksNum - 1];
+
+    return ~crc;
+}
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -91,5 +208,19 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+void RepackedWeights::add(const std::string& nodeName, const std::string& format, const void* data, size_t size,
+                          std::shared_ptr<void> holder) {
+    weights[makeKey(nodeName, format)] = {data, size};
+    if (holder && (holders.empty() || holders.back() != holder))
+        holders.push_back(std::move(holder));
+}
+
+const void* RepackedWeights::find(const std::string& nodeName, const std::string& format, size_t size) const {
+    auto found = weights.find(makeKey(nodeName, format));
+    if (found == weights.end() || found->second.second != size)
+        return nullptr;
+    return found->second.first;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
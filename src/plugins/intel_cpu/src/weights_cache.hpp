@@ -13,6 +13,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -25,26 +26,22 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+    SimpleDataHash();
 
-        return ~crc;
-    }
+    /**
+     * @brief Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
+     * @note Large buffers are split into chunks which are processed in parallel and combined afterwards,
+     *       so the result doesn't depend on the number of threads and is equal to the sequential computation
+     */
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
 protected:
+    // updates the crc register (no initial and final inversion) with the given data using slicing-by-8 approach
+    uint64_t update(uint64_t crc, const unsigned char* data, size_t size) const;
+
     static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static constexpr int kSlicesNum = 8;
+    uint64_t table[kSlicesNum][kTableSize];
 };
 
 /**
@@ -118,5 +115,38 @@ private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
 
+/**
+ * Read only store of the nodes weights already repacked into the layouts of the selected primitives.
+ * It is restored from the model blob, so the imported graph doesn't need to reorder the weights again.
+ * The weights are looked up by the node name and the serialized format of the weights memory descriptor.
+ */
+class RepackedWeights {
+public:
+    typedef std::shared_ptr<RepackedWeights> Ptr;
+    typedef std::shared_ptr<const RepackedWeights> CPtr;
+
+    /**
+     * @brief Registers the weights data
+     * @param holder keeps the data alive while the store exists (e.g. the mapped blob)
+     */
+    void add(const std::string& nodeName, const std::string& format, const void* data, size_t size,
+             std::shared_ptr<void> holder);
+
+    // returns nullptr if there are no weights of the requested size for the node and format
+    const void* find(const std::string& nodeName, const std::string& format, size_t size) const;
+
+    bool empty() const {
+        return weights.empty();
+    }
+
+private:
+    static std::string makeKey(const std::string& nodeName, const std::string& format) {
+        return nodeName + "_" + format;
+    }
+
+    std::unordered_map<std::string, std::pair<const void*, size_t>> weights;
+    std::vector<std::shared_ptr<void>> holders;
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -13,6 +13,9 @@
 #include <openvino/opsets/opset9.hpp>
 #include <ie/ie_core.hpp>
 
+#include <iterator>
+#include <sstream>
+
 namespace {
 
 using PropertiesParams = std::tuple<std::string, std::vector<ov::AnyMap>>;
@@ -96,6 +99,83 @@ TEST_P(ExportOptimalNumStreams, OptimalNumStreams) {
     }
 }
 
+std::vector<float> InferMatMulModel(ov::CompiledModel& network) {
+    auto input = network.input();
+    ov::Tensor input_tensor(input.get_element_type(), input.get_shape());
+    auto input_data = input_tensor.data<float>();
+    for (size_t i = 0; i < input_tensor.get_size(); i++) {
+        input_data[i] = static_cast<float>(i % 17) / 17.f - 0.5f;
+    }
+
+    auto request = network.create_infer_request();
+    request.set_input_tensor(input_tensor);
+    request.infer();
+    const auto& output = request.get_output_tensor();
+    const auto output_data = output.data<float>();
+    return std::vector<float>(output_data, output_data + output.get_size());
+}
+
+// imports the blob followed by some other data, the import must stop right after the model
+void CheckImportedMatMulModel(ov::Core& core, ov::CompiledModel& original_network, const std::string& blob) {
+    const std::string trailer = "TRAILER!";
+    std::stringstream stream(blob + trailer);
+    auto imported_network = core.import_model(stream, "CPU", {ov::num_streams(1)});
+
+    std::string rest{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    EXPECT_EQ(rest, trailer);
+    EXPECT_EQ(InferMatMulModel(original_network), InferMatMulModel(imported_network));
+}
+
+// the repacked weights section follows the model, see CNNNetworkSerializer::writeRepackedWeights
+size_t FindRepackedWeightsSection(const std::string& blob) {
+    const auto position = blob.rfind("RPCWGHTS");
+    EXPECT_NE(position, std::string::npos);
+    return position;
+}
+
+// the imported model reuses the weights repacked by the exported one, so the results must be the same
+TEST(ExportImportTest, smoke_ImportedRepackedWeights) {
+    auto original_model = MakeMatMulModel();
+    ov::Core core;
+    auto original_network = core.compile_model(original_model, "CPU", {ov::num_streams(1)});
+
+    std::stringstream exported_model;
+    original_network.export_model(exported_model);
+    CheckImportedMatMulModel(core, original_network, exported_model.str());
+}
+
+// the repacked weights of another ISA are skipped, the weights are repacked on import
+TEST(ExportImportTest, smoke_ImportedRepackedWeightsOfAnotherIsa) {
+    auto original_model = MakeMatMulModel();
+    ov::Core core;
+    auto original_network = core.compile_model(original_model, "CPU", {ov::num_streams(1)});
+
+    std::stringstream exported_model;
+    original_network.export_model(exported_model);
+    auto blob = exported_model.str();
+    // [ magic | section size | ISA | ... ]
+    const auto isa_offset = FindRepackedWeightsSection(blob) + 2 * sizeof(uint64_t);
+    ASSERT_LE(isa_offset + sizeof(uint64_t), blob.size());
+    const uint64_t another_isa = ~0ull;
+    blob.replace(isa_offset, sizeof(another_isa), reinterpret_cast<const char*>(&another_isa), sizeof(another_isa));
+
+    CheckImportedMatMulModel(core, original_network, blob);
+}
+
+// the models exported without the repacked weights are imported as is
+TEST(ExportImportTest, smoke_ImportedWithoutRepackedWeights) {
+    auto original_model = MakeMatMulModel();
+    ov::Core core;
+    auto original_network = core.compile_model(original_model, "CPU", {ov::num_streams(1)});
+
+    std::stringstream exported_model;
+    original_network.export_model(exported_model);
+    auto blob = exported_model.str();
+    blob.resize(FindRepackedWeightsSection(blob));
+
+    CheckImportedMatMulModel(core, original_network, blob);
+}
+
 const std::vector<ov::AnyMap> testing_property_for_streams = {{ov::num_streams(1)}, {ov::num_streams(2)}};
 
 const std::vector<ov::AnyMap> testing_property_for_threads = {{ov::inference_num_threads(1)},
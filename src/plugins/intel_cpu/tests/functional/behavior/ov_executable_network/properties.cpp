@@ -12,6 +12,7 @@
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/opsets/opset1.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 
 namespace {
@@ -40,6 +41,10 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::shape_cache_hits.name()),
+        RO_property(ov::intel_cpu::shape_cache_misses.name()),
+        RO_property(ov::intel_cpu::memory_workspace_size.name()),
+        RO_property(ov::intel_cpu::memory_fragmentation.name()),
     };
 
     ov::Core ie;
@@ -144,6 +149,52 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSharedStreamsCache) {
+    ov::Core core;
+    bool value = false;
+
+    core.set_property(deviceName, ov::intel_cpu::shared_streams_cache(true));
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName, ov::num_streams(4)));
+    ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::shared_streams_cache));
+    ASSERT_TRUE(value);
+
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 4; ++i) {
+        requests.push_back(compiledModel.create_infer_request());
+    }
+    for (auto& request : requests) {
+        ASSERT_NO_THROW(request.start_async());
+    }
+    for (auto& request : requests) {
+        ASSERT_NO_THROW(request.wait());
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckStickyStreams) {
+    ov::Core core;
+    bool value = false;
+
+    core.set_property(deviceName, ov::intel_cpu::sticky_streams(true));
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName, ov::num_streams(4)));
+    ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::sticky_streams));
+    ASSERT_TRUE(value);
+
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 6; ++i) {
+        requests.push_back(compiledModel.create_infer_request());
+    }
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        for (auto& request : requests) {
+            ASSERT_NO_THROW(request.start_async());
+        }
+        for (auto& request : requests) {
+            ASSERT_NO_THROW(request.wait());
+        }
+    }
+}
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
@@ -216,4 +267,43 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckModelInferencePrecisionHas
     ASSERT_EQ(inference_precision_value, inference_precision_expected);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckShapeCacheCounters) {
+    ov::Core ie;
+
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 3, -1, -1});
+    auto relu = std::make_shared<ov::opset1::Relu>(param);
+    auto result = std::make_shared<ov::opset1::Result>(relu);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    ov::CompiledModel compiledModel = ie.compile_model(dynamicModel, deviceName, ov::num_streams(1));
+    auto inferRequest = compiledModel.create_infer_request();
+
+    for (const auto& shape : std::vector<ov::Shape>{{1, 3, 8, 8}, {1, 3, 16, 16}, {1, 3, 8, 8}, {1, 3, 16, 16}}) {
+        inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, shape));
+        ASSERT_NO_THROW(inferRequest.infer());
+    }
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    ASSERT_NO_THROW(hits = compiledModel.get_property(ov::intel_cpu::shape_cache_hits));
+    ASSERT_NO_THROW(misses = compiledModel.get_property(ov::intel_cpu::shape_cache_misses));
+    ASSERT_EQ(hits, 2);
+    ASSERT_EQ(misses, 2);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckMemoryWorkspaceStatistics) {
+    ov::Core ie;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, ov::num_streams(1));
+
+    uint64_t workspaceSize = 0;
+    float fragmentation = -1.f;
+    ASSERT_NO_THROW(workspaceSize = compiledModel.get_property(ov::intel_cpu::memory_workspace_size));
+    ASSERT_NO_THROW(fragmentation = compiledModel.get_property(ov::intel_cpu::memory_fragmentation));
+    ASSERT_GT(workspaceSize, 0);
+    ASSERT_EQ(workspaceSize % 64, 0);
+    ASSERT_GE(fragmentation, 0.f);
+    ASSERT_LT(fragmentation, 1.f);
+}
+
 } // namespace
@@ -47,6 +47,8 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RW_property(ov::intel_cpu::shared_streams_cache.name()),
+        RW_property(ov::intel_cpu::sticky_streams.name()),
     };
 
     ov::Core ie;
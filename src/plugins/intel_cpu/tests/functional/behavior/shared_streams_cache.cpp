@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <openvino/opsets/opset11.hpp>
+
+namespace {
+
+// DeformableConvolution, Eltwise and pillow Interpolate executors keep per-call data, so the dynamic batch is used
+// to make each stream run the shared executors with its own shapes
+std::shared_ptr<ov::Model> MakeDeformableConvInterpolateModel() {
+    const ov::element::Type precision = ov::element::f32;
+    auto data = std::make_shared<ov::opset11::Parameter>(precision, ov::PartialShape{-1, 4, 16, 16});
+    auto offsets = std::make_shared<ov::opset11::Parameter>(precision, ov::PartialShape{-1, 18, 14, 14});
+    auto mask = std::make_shared<ov::opset11::Parameter>(precision, ov::PartialShape{-1, 9, 14, 14});
+    auto weights = ngraph::builder::makeConstant(precision, {8, 4, 3, 3}, std::vector<float>{}, true);
+
+    auto def_conv = std::make_shared<ov::opset11::DeformableConvolution>(data,
+                                                                          offsets,
+                                                                          weights,
+                                                                          mask,
+                                                                          ov::Strides{1, 1},
+                                                                          ov::CoordinateDiff{0, 0},
+                                                                          ov::CoordinateDiff{0, 0},
+                                                                          ov::Strides{1, 1});
+    auto add_const = ngraph::builder::makeConstant(precision, {1, 8, 1, 1}, std::vector<float>{}, true);
+    auto add = ngraph::builder::makeEltwise(def_conv, add_const, ngraph::helpers::EltwiseTypes::ADD);
+
+    ov::opset11::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = ov::opset11::Interpolate::InterpolateMode::BILINEAR_PILLOW;
+    attrs.shape_calculation_mode = ov::opset11::Interpolate::ShapeCalcMode::SIZES;
+    attrs.pads_begin = {0, 0, 0, 0};
+    attrs.pads_end = {0, 0, 0, 0};
+    auto sizes = ov::opset11::Constant::create(ov::element::i32, {2}, {20, 20});
+    auto axes = ov::opset11::Constant::create(ov::element::i32, {2}, {2, 3});
+    auto interpolate = std::make_shared<ov::opset11::Interpolate>(add, sizes, axes, attrs);
+
+    ngraph::NodeVector results{interpolate};
+    return std::make_shared<ov::Model>(results, ov::ParameterVector{data, offsets, mask}, "DefConvInterpolateModel");
+}
+
+TEST(SharedStreamsCacheTest, smoke_ConcurrentStreamsMatchSingleStreamResults) {
+    const size_t requests_num = 4;
+    const size_t iterations = 10;
+    auto model = MakeDeformableConvInterpolateModel();
+    ov::Core core;
+
+    std::vector<std::vector<ov::Tensor>> inputs(requests_num);
+    std::vector<ov::Tensor> expected(requests_num);
+    {
+        auto reference_model = core.compile_model(model, "CPU", ov::num_streams(1));
+        auto reference_request = reference_model.create_infer_request();
+        for (size_t i = 0; i < requests_num; i++) {
+            const size_t batch = i + 1;
+            for (const auto& param : model->get_parameters()) {
+                auto shape = param->get_partial_shape();
+                shape[0] = batch;
+                inputs[i].push_back(ov::test::utils::create_and_fill_tensor(param->get_element_type(),
+                                                                            shape.to_shape(),
+                                                                            4,
+                                                                            -2,
+                                                                            8,
+                                                                            static_cast<int>(i + 1)));
+            }
+            for (size_t j = 0; j < inputs[i].size(); j++) {
+                reference_request.set_input_tensor(j, inputs[i][j]);
+            }
+            reference_request.infer();
+            const auto output = reference_request.get_output_tensor();
+            expected[i] = ov::Tensor(output.get_element_type(), output.get_shape());
+            output.copy_to(expected[i]);
+        }
+    }
+
+    auto compiled_model = core.compile_model(model,
+                                             "CPU",
+                                             ov::num_streams(static_cast<int>(requests_num)),
+                                             ov::intel_cpu::shared_streams_cache(true));
+    ASSERT_TRUE(compiled_model.get_property(ov::intel_cpu::shared_streams_cache));
+
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < requests_num; i++) {
+        requests.push_back(compiled_model.create_infer_request());
+        for (size_t j = 0; j < inputs[i].size(); j++) {
+            requests[i].set_input_tensor(j, inputs[i][j]);
+        }
+    }
+    for (size_t iter = 0; iter < iterations; iter++) {
+        for (auto& request : requests) {
+            ASSERT_NO_THROW(request.start_async());
+        }
+        for (size_t i = 0; i < requests_num; i++) {
+            ASSERT_NO_THROW(requests[i].wait());
+            ov::test::utils::compare(expected[i], requests[i].get_output_tensor(), 1e-5, 1e-5);
+        }
+    }
+}
+
+}  // namespace
@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "common_test_utils/test_common.hpp"
+
+#include <openvino/opsets/opset9.hpp>
+
+namespace {
+
+constexpr size_t stateSize = 16;
+
+std::shared_ptr<ov::Model> MakeAccumulatorModel() {
+    auto param = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, stateSize});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, stateSize}, ov::element::f32, "accumulator"});
+    auto init = ov::opset9::Constant::create(ov::element::f32, ov::Shape{1, stateSize}, {0});
+    auto readValue = std::make_shared<ov::opset9::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::opset9::Add>(readValue, param);
+    auto assign = std::make_shared<ov::opset9::Assign>(add, variable);
+    auto result = std::make_shared<ov::opset9::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{param});
+}
+
+// the state is also read by a consumer which does not modify it in place, so it is passed to the graph without a copy
+std::shared_ptr<ov::Model> MakeSharedStateModel() {
+    auto param = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, stateSize});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, stateSize}, ov::element::f32, "accumulator"});
+    auto init = ov::opset9::Constant::create(ov::element::f32, ov::Shape{1, stateSize}, {0});
+    auto readValue = std::make_shared<ov::opset9::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::opset9::Add>(readValue, param);
+    auto assign = std::make_shared<ov::opset9::Assign>(add, variable);
+    auto scale = ov::opset9::Constant::create(ov::element::f32, ov::Shape{1, stateSize}, {2});
+    auto mul = std::make_shared<ov::opset9::Multiply>(readValue, scale);
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset9::Result>(add),
+                                                        std::make_shared<ov::opset9::Result>(mul)},
+                                       ov::SinkVector{assign},
+                                       ov::ParameterVector{param});
+}
+
+void infer(ov::InferRequest& request, float value) {
+    ov::Tensor input(ov::element::f32, {1, stateSize});
+    std::fill_n(input.data<float>(), stateSize, value);
+    request.set_input_tensor(input);
+    request.infer();
+}
+
+void checkValues(const ov::Tensor& tensor, float expected) {
+    ASSERT_EQ(tensor.get_size(), stateSize);
+    for (size_t i = 0; i < stateSize; i++) {
+        ASSERT_EQ(tensor.data<float>()[i], expected) << "index: " << i;
+    }
+}
+
+TEST(VariableStateTest, smoke_StatesOfRequestsAreIndependent) {
+    ov::Core core;
+    auto compiledModel = core.compile_model(MakeAccumulatorModel(), "CPU");
+    auto request1 = compiledModel.create_infer_request();
+    auto request2 = compiledModel.create_infer_request();
+
+    for (int i = 1; i <= 3; i++) {
+        infer(request1, 1.f);
+        checkValues(request1.get_output_tensor(), static_cast<float>(i));
+        checkValues(request1.query_state().front().get_state(), static_cast<float>(i));
+    }
+    infer(request2, 5.f);
+    checkValues(request2.get_output_tensor(), 5.f);
+    checkValues(request1.query_state().front().get_state(), 3.f);
+
+    request1.query_state().front().reset();
+    infer(request1, 2.f);
+    checkValues(request1.get_output_tensor(), 2.f);
+    checkValues(request1.query_state().front().get_state(), 2.f);
+}
+
+TEST(VariableStateTest, smoke_UserTensorKeepsState) {
+    ov::Core core;
+    auto compiledModel = core.compile_model(MakeAccumulatorModel(), "CPU");
+    auto request = compiledModel.create_infer_request();
+
+    ov::Tensor userState(ov::element::f32, {1, stateSize});
+    std::fill_n(userState.data<float>(), stateSize, 10.f);
+    request.query_state().front().set_state(userState);
+    for (int i = 1; i <= 2; i++) {
+        infer(request, 1.f);
+        checkValues(request.get_output_tensor(), 10.f + i);
+        // the new state is stored to the user's tensor
+        checkValues(userState, 10.f + i);
+    }
+}
+
+TEST(VariableStateTest, smoke_StateTensorFollowsInferences) {
+    ov::Core core;
+    auto compiledModel = core.compile_model(MakeSharedStateModel(), "CPU");
+    auto request = compiledModel.create_infer_request();
+
+    // the tensor is kept across the inferences, which swap the state buffers
+    auto state = request.query_state().front().get_state();
+    checkValues(state, 0.f);
+    for (int i = 1; i <= 3; i++) {
+        infer(request, 1.f);
+        checkValues(request.get_output_tensor(0), static_cast<float>(i));
+        checkValues(request.get_output_tensor(1), 2.f * (i - 1));
+        checkValues(state, static_cast<float>(i));
+    }
+
+    // the values written to the tensor are the state of the next inference
+    std::fill_n(state.data<float>(), stateSize, 10.f);
+    infer(request, 1.f);
+    checkValues(request.get_output_tensor(0), 11.f);
+    checkValues(request.get_output_tensor(1), 20.f);
+    checkValues(state, 11.f);
+}
+
+}  // namespace
@@ -77,7 +77,11 @@ protected:
         size_t numSegments, defaultIndex;
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // f16 tables, and bf16 ones on platforms without avx512_core, are converted to f32 by the plugin
+        auto nodePrecision = inType;
+        if (inType == ElementType::f16 || (inType == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core()))
+            nodePrecision = ElementType::f32;
+        selectedType = makeSelectedTypeStr("ref", nodePrecision);
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -108,6 +112,8 @@ TEST_P(EmbeddingSegmentsSumLayerCPUTest, CompareWithRefs) {
 namespace {
 const std::vector<ElementType> netPrecisions = {
         ElementType::f32,
+        ElementType::bf16,
+        ElementType::f16,
         ElementType::i32,
         ElementType::u8
 };
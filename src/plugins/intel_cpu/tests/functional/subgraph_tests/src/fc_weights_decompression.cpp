@@ -0,0 +1,306 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/fusing_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* This test checks that the decompression subgraph of the INT8/INT4 weights is fused into FullyConnected,
+ * which keeps the weights compressed and decompresses them in its own gemm, and that the result is accurate.
+ * The subgraph is kept as is only when few source rows reuse the weights, otherwise it is constant folded.
+
+ * Graph before:
+   ------------    ------------------------------------
+   |Input(f32)|    |Constant(weights u8/i8/u4/i4)     |
+   ------------    ------------------------------------
+        |                         |
+        |                   -----------    --------------------------------
+        |                   | Convert |    |Constant(zero point) + Convert|
+        |                   -----------    --------------------------------
+        |                         |              |
+        |                   ---------------------------
+        |                   |      [Subtract]         |
+        |                   ---------------------------
+        |                         |
+        |                   ---------------------------
+        |                   | Multiply(Constant scale)|
+        |                   ---------------------------
+        |                         |
+        |                   --------------------------------------
+        |                   | [Reshape, for the grouped weights] |
+        |                   --------------------------------------
+        |                         |
+    ---------------------------------
+    |            MatMul             |
+    ---------------------------------
+                    |
+           --------------------
+           | [fused post ops] |
+           --------------------
+                    |
+                --------
+                |Output|
+                --------
+
+ * Exec graph:
+   ------------    ----------------------------
+   |Input(f32)|    |Const(u8/i8) -> [Reshape] |
+   ------------    ----------------------------
+        |               |
+   ----------------------------
+   |      FullyConnected      |
+   ----------------------------
+                 |
+              --------
+              |Output|
+              --------
+*/
+
+struct WeightsDecompressionShapeParams {
+    InputShape data;
+    size_t N;
+    // the scale and the zero point are per output channel if 0
+    size_t groupSize;
+};
+
+using FCWeightsDecompressionParams = std::tuple<WeightsDecompressionShapeParams,
+                                                ElementType,                        // weights precision
+                                                bool,                               // transpose_b
+                                                bool,                               // with zero point
+                                                fusingSpecificParams,
+                                                std::map<std::string, std::string>>;  // additional config
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                                   virtual public SubgraphBaseTest,
+                                   public CpuTestWithFusing {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj) {
+        WeightsDecompressionShapeParams shapeParams;
+        ElementType weightsPrecision;
+        bool transposeB;
+        bool withZeroPoint;
+        fusingSpecificParams fusingParams;
+        std::map<std::string, std::string> additionalConfig;
+        std::tie(shapeParams, weightsPrecision, transposeB, withZeroPoint, fusingParams, additionalConfig) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({shapeParams.data.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : shapeParams.data.second) {
+            result << "(" << ov::test::utils::vec2str(shape) << ")_";
+        }
+        result << "N=" << shapeParams.N << "_";
+        result << "group=" << shapeParams.groupSize << "_";
+        result << "weightsPRC=" << weightsPrecision << "_";
+        result << "transpose_b=" << transposeB << "_";
+        result << "zero_point=" << withZeroPoint << "_";
+
+        result << "config=(";
+        for (const auto& configEntry : additionalConfig) {
+            result << configEntry.first << ", " << configEntry.second << ":";
+        }
+        result << ")";
+        result << CpuTestWithFusing::getTestCaseName(fusingParams);
+
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<Node> makeDecompressedWeights(const ov::Shape& weightsShape, const ov::Shape& paramShape, size_t K) {
+        // every byte is random, so the values cover the whole range of the 8 bit and the 4 bit precisions
+        auto weightsTensor = ov::test::utils::create_and_fill_tensor(weightsPrecision, weightsShape, 256, 0, 1, 1);
+        auto weights = std::make_shared<opset1::Constant>(weightsTensor);
+        std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(weights, element::f32);
+
+        if (withZeroPoint) {
+            auto zeroPointTensor = ov::test::utils::create_and_fill_tensor(weightsPrecision, paramShape, 256, 0, 1, 2);
+            auto zeroPoint = std::make_shared<opset1::Convert>(std::make_shared<opset1::Constant>(zeroPointTensor), element::f32);
+            decompressed = std::make_shared<opset1::Subtract>(decompressed, zeroPoint);
+        }
+
+        // the scale keeps the output in the range of the source values, so the absolute threshold fits all the shapes
+        auto scaleTensor = ov::test::utils::create_and_fill_tensor(element::f32, paramShape, 1, 0, 1000, 3);
+        auto scaleData = scaleTensor.data<float>();
+        for (size_t i = 0; i < scaleTensor.get_size(); i++)
+            scaleData[i] /= static_cast<float>(K * 16);
+        auto scale = std::make_shared<opset1::Constant>(scaleTensor);
+        return std::make_shared<opset1::Multiply>(decompressed, scale);
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        WeightsDecompressionShapeParams shapeParams;
+        bool transposeB;
+        fusingSpecificParams fusingParams;
+        std::map<std::string, std::string> additionalConfig;
+        std::tie(shapeParams, weightsPrecision, transposeB, withZeroPoint, fusingParams, additionalConfig) = this->GetParam();
+        std::tie(postOpMgrPtr, fusedOps) = fusingParams;
+
+        init_input_shapes({shapeParams.data});
+        configuration.insert(additionalConfig.begin(), additionalConfig.end());
+
+        // the gemm with compressed weights reads and writes BF16 data when the inference precision is BF16
+        const bool enforceBF16 = additionalConfig[PluginConfigParams::KEY_ENFORCE_BF16] == PluginConfigParams::YES;
+        const ElementType netType = element::f32;
+        inType = outType = netType;
+        abs_threshold = enforceBF16 ? 0.1 : 1e-4;
+
+        const auto& dataShape = inputDynamicShapes[0];
+        const size_t K = dataShape[dataShape.size() - 1].get_length();
+        const size_t N = shapeParams.N;
+        std::shared_ptr<Node> weights;
+        if (shapeParams.groupSize) {
+            const size_t groups = K / shapeParams.groupSize;
+            weights = makeDecompressedWeights({N, groups, shapeParams.groupSize}, {N, groups, 1}, K);
+            auto targetShape = opset1::Constant::create(element::i64, {2}, {N, K});
+            weights = std::make_shared<opset1::Reshape>(weights, targetShape, false);
+        } else if (transposeB) {
+            weights = makeDecompressedWeights({N, K}, {N, 1}, K);
+        } else {
+            weights = makeDecompressedWeights({K, N}, {1, N}, K);
+        }
+
+        auto params = builder::makeDynamicParams(inType, {dataShape});
+        auto matMul = builder::makeMatMul(params[0], weights, false, transposeB);
+
+        // the rows of the source which reuse every decompressed weight
+        Dimension rows = 1;
+        for (size_t i = 0; i + 1 < dataShape.size(); i++)
+            rows *= dataShape[i];
+        expectCompressedWeights = rows.is_dynamic() || rows.get_length() <= 16;
+        selectedType = expectCompressedWeights ? makeSelectedTypeStr("gemm_any", enforceBF16 ? ElementType::bf16 : netType) : any_type;
+
+        function = makeNgraphFunction(netType, params, matMul, "FCWeightsDecompression");
+    }
+
+    void CheckCompressedWeights() const {
+        auto getExecValue = [](const ov::Node::RTMap& rtInfo, const std::string& paramName) -> std::string {
+            auto it = rtInfo.find(paramName);
+            IE_ASSERT(rtInfo.end() != it);
+            return it->second.as<std::string>();
+        };
+
+        const auto execFunction = compiledModel.get_runtime_model();
+        ASSERT_NE(nullptr, execFunction);
+        for (const auto& fcNode : execFunction->get_ops()) {
+            if (getExecValue(fcNode->get_rt_info(), ExecGraphInfoSerialization::LAYER_TYPE) != "FullyConnected")
+                continue;
+            auto constNode = fcNode->get_input_node_shared_ptr(1);
+            if (getExecValue(constNode->get_rt_info(), ExecGraphInfoSerialization::LAYER_TYPE) == "Reshape")
+                constNode = constNode->get_input_node_shared_ptr(0);
+            ASSERT_EQ(getExecValue(constNode->get_rt_info(), ExecGraphInfoSerialization::LAYER_TYPE), "Const");
+            // U4/I4 weights are unpacked to U8/I8 by the plugin transformations
+            const auto precision = getExecValue(constNode->get_rt_info(), ExecGraphInfoSerialization::OUTPUT_PRECISIONS);
+            const bool isCompressed = precision == "U8" || precision == "I8";
+            ASSERT_EQ(expectCompressedWeights, isCompressed) << "FullyConnected weights precision: " << precision;
+        }
+    }
+
+    ElementType weightsPrecision;
+    bool withZeroPoint = false;
+    bool expectCompressedWeights = false;
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "FullyConnected");
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    CheckCompressedWeights();
+}
+
+namespace {
+
+std::vector<std::map<std::string, std::string>> filterAdditionalConfig() {
+    std::vector<std::map<std::string, std::string>> additionalConfig;
+    additionalConfig.push_back(std::map<std::string, std::string>{/* empty config */});
+    if (with_cpu_x86_avx512_core()) {
+        additionalConfig.push_back({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}});
+    }
+
+    return additionalConfig;
+}
+
+const std::vector<ElementType> weightsPrecisions = {element::u8, element::i8, element::u4, element::i4};
+
+const std::vector<fusingSpecificParams> fusingParamsSet = {
+    emptyFusingSpec,
+    fusingRelu,
+    fusingReluScaleShift,
+};
+
+// the odd K leaves a half empty byte at the end of every row of the U4/I4 weights
+const std::vector<WeightsDecompressionShapeParams> perChannelShapes = {
+    {{{}, {{1, 64}}}, 48, 0},
+    {{{}, {{2, 3, 63}}}, 37, 0},
+    {{{-1, 63}, {{1, 63}, {20, 63}, {1, 63}}}, 16, 0},
+    {{{-1, -1, 64}, {{1, 1, 64}, {1, 5, 64}}}, 33, 0},
+};
+
+const auto testParamsPerChannel_smoke = ::testing::Combine(::testing::ValuesIn(perChannelShapes),
+                                                           ::testing::ValuesIn(weightsPrecisions),
+                                                           ::testing::Values(true),
+                                                           ::testing::Values(false, true),
+                                                           ::testing::ValuesIn(fusingParamsSet),
+                                                           ::testing::ValuesIn(filterAdditionalConfig()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_PerChannel, FCWeightsDecompressionTest, testParamsPerChannel_smoke,
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+// the groups of input channels cross the K blocks of the gemm
+const std::vector<WeightsDecompressionShapeParams> groupedShapes = {
+    {{{}, {{1, 96}}}, 40, 32},
+    {{{-1, -1, 288}, {{1, 1, 288}, {2, 7, 288}}}, 17, 96},
+};
+
+const auto testParamsGrouped_smoke = ::testing::Combine(::testing::ValuesIn(groupedShapes),
+                                                        ::testing::ValuesIn(weightsPrecisions),
+                                                        ::testing::Values(true),
+                                                        ::testing::Values(false, true),
+                                                        ::testing::Values(emptyFusingSpec, fusingReluScaleShift),
+                                                        ::testing::ValuesIn(filterAdditionalConfig()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_Grouped, FCWeightsDecompressionTest, testParamsGrouped_smoke,
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+// the 8 bit weights which are not transposed are transposed by the plugin
+const auto testParamsNotTransposed_smoke = ::testing::Combine(::testing::ValuesIn(perChannelShapes),
+                                                              ::testing::Values(element::u8, element::i8),
+                                                              ::testing::Values(false),
+                                                              ::testing::Values(true),
+                                                              ::testing::Values(emptyFusingSpec),
+                                                              ::testing::ValuesIn(filterAdditionalConfig()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_NotTransposed, FCWeightsDecompressionTest, testParamsNotTransposed_smoke,
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+// many static rows reuse the weights, so they are decompressed at load time and the FC is executed by oneDNN
+const std::vector<WeightsDecompressionShapeParams> manyRowsShapes = {
+    {{{}, {{32, 64}}}, 48, 0},
+    {{{}, {{2, 16, 96}}}, 40, 32},
+};
+
+const auto testParamsManyRows_smoke = ::testing::Combine(::testing::ValuesIn(manyRowsShapes),
+                                                         ::testing::Values(element::u8, element::u4),
+                                                         ::testing::Values(true),
+                                                         ::testing::Values(true),
+                                                         ::testing::Values(emptyFusingSpec, fusingReluScaleShift),
+                                                         ::testing::ValuesIn(filterAdditionalConfig()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_ManyRows, FCWeightsDecompressionTest, testParamsManyRows_smoke,
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
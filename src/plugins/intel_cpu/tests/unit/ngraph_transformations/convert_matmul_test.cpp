@@ -13,6 +13,7 @@
 #include <ngraph/opsets/opset7.hpp>
 #include <transformations/cpu_opset/common/op/fully_connected.hpp>
 #include <transformations/cpu_opset/common/pass/convert_matmul_to_fc.hpp>
+#include <transformations/cpu_opset/common/pass/mark_fc_weights_decompression.hpp>
 #include <transformations/init_node_info.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
@@ -362,4 +363,61 @@ TEST_F(TransformationTestsF, ConvertMatMulToFCTest_decompress_convert_1) {
 
         function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
     }
-}
\ No newline at end of file
+}
+TEST_F(TransformationTestsF, ConvertMatMulToFCTest_weights_decompression_grouped) {
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u4, ngraph::Shape{ 4, 2, 4 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 2, 1 }, { 8 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 2, 1 }, { 2 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { -1, 8 });
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, reshape_const, false);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, reshape, false, true);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        manager.register_pass<MarkFCWeightsDecompression>();
+        manager.register_pass<ConvertMatMulToFC>();
+    }
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u4, ngraph::Shape{ 4, 2, 4 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 2, 1 }, { 8 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 2, 1 }, { 2 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { -1, 8 });
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, reshape_const, false);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, reshape, ngraph::Rank(3));
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+}
+
+TEST_F(TransformationTestsF, ConvertMatMulToFCTest_weights_decompression_not_transposed) {
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 8, 4 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 4 }, { 2 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, false);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        manager.register_pass<MarkFCWeightsDecompression>();
+        manager.register_pass<ConvertMatMulToFC>();
+    }
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 4, 8 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 2 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, multiply, ngraph::Rank(2));
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+}
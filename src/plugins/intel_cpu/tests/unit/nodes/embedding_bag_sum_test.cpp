@@ -0,0 +1,215 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include <openvino/core/type/float16.hpp>
+#include <openvino/opsets/opset3.hpp>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/embedding_bag_sum.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace {
+
+// runs the shared EmbeddingBagSum kernel on bags given by offsets, as EmbeddingBagOffsetsSum does,
+// f16 models are converted to f32 by the plugin, so the FP16 tables are not covered by the single layer tests
+class EmbeddingBagSumTestNode : public node::EmbeddingBagSum {
+public:
+    EmbeddingBagSumTestNode(const std::shared_ptr<ov::Node>& op, std::vector<int> indices, std::vector<int> offsets)
+        : EmbeddingBagSum(op, 3lu, 1lu, 4lu, 3lu), _indices(std::move(indices)), _offsets(std::move(offsets)) {}
+
+    void run(const void* table, const void* weights, Precision prc, const VectorDims& tableDims, const MemoryPtr& dst) {
+        prepareParams(tableDims);
+        execute(reinterpret_cast<const uint8_t*>(table), reinterpret_cast<const uint8_t*>(weights), prc, tableDims, dst);
+    }
+
+protected:
+    void initFromInputs() override {}
+
+    void getIndices(size_t embIndex, const int*& indices, size_t& size, int& weightsIdx, bool&) override {
+        const size_t begin = _offsets[embIndex];
+        const size_t end = embIndex + 1lu < _offsets.size() ? _offsets[embIndex + 1lu] : _indices.size();
+        size = end - begin;
+        indices = size ? _indices.data() + begin : nullptr;
+        weightsIdx = static_cast<int>(begin);
+    }
+
+private:
+    std::vector<int> _indices;
+    std::vector<int> _offsets;
+};
+
+ov::element::Type toElementType(Precision prc) {
+    switch (prc) {
+    case Precision::BF16: return ov::element::bf16;
+    case Precision::FP16: return ov::element::f16;
+    default: return ov::element::f32;
+    }
+}
+
+std::shared_ptr<ov::Node> makeEmbeddingBagOffsetsSum(Precision prc, size_t rows, size_t depth, size_t indicesNum,
+                                                     size_t bagsNum, bool withWeights) {
+    const auto type = toElementType(prc);
+    auto table = std::make_shared<ov::opset3::Parameter>(type, ov::Shape{rows, depth});
+    auto indices = std::make_shared<ov::opset3::Parameter>(ov::element::i32, ov::Shape{indicesNum});
+    auto offsets = std::make_shared<ov::opset3::Parameter>(ov::element::i32, ov::Shape{bagsNum});
+    auto defaultIndex = std::make_shared<ov::opset3::Parameter>(ov::element::i32, ov::Shape{});
+    if (!withWeights)
+        return std::make_shared<ov::opset3::EmbeddingBagOffsetsSum>(table, indices, offsets, defaultIndex);
+    auto weights = std::make_shared<ov::opset3::Parameter>(type, ov::Shape{indicesNum});
+    return std::make_shared<ov::opset3::EmbeddingBagOffsetsSum>(table, indices, offsets, defaultIndex, weights);
+}
+
+MemoryPtr makeMemory(Precision prc, const VectorDims& dims) {
+    static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    return std::make_shared<Memory>(eng, CpuBlockedMemoryDesc(prc, Shape(dims)));
+}
+
+// the values are stored in the table precision and read back as float for the reference
+struct TableData {
+    explicit TableData(Precision prc) : prc(prc) {}
+
+    void push_back(float value) {
+        switch (prc) {
+        case Precision::BF16: bf16.emplace_back(value); values.push_back(static_cast<float>(bf16.back())); break;
+        case Precision::FP16: f16.emplace_back(value); values.push_back(static_cast<float>(f16.back())); break;
+        default: f32.push_back(value); values.push_back(value); break;
+        }
+    }
+
+    const void* data() const {
+        switch (prc) {
+        case Precision::BF16: return bf16.data();
+        case Precision::FP16: return f16.data();
+        default: return f32.data();
+        }
+    }
+
+    Precision prc;
+    std::vector<float> values;
+    std::vector<float> f32;
+    std::vector<bfloat16_t> bf16;
+    std::vector<ov::float16> f16;
+};
+
+float readValue(const MemoryPtr& memory, size_t i) {
+    switch (memory->getDesc().getPrecision()) {
+    case Precision::BF16: return static_cast<float>(reinterpret_cast<const bfloat16_t*>(memory->getData())[i]);
+    case Precision::FP16: return static_cast<float>(reinterpret_cast<const ov::float16*>(memory->getData())[i]);
+    default: return reinterpret_cast<const float*>(memory->getData())[i];
+    }
+}
+
+using EmbeddingBagSumParams = std::tuple<Precision,  // table and per sample weights precision
+                                         size_t,     // embedding depth
+                                         bool>;      // with per sample weights
+
+class EmbeddingBagSumTest : public testing::TestWithParam<EmbeddingBagSumParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagSumParams>& obj) {
+        Precision prc;
+        size_t depth;
+        bool withWeights;
+        std::tie(prc, depth, withWeights) = obj.param;
+
+        std::ostringstream result;
+        result << "prc=" << prc.name() << "_depth=" << depth << "_WW" << withWeights;
+        return result.str();
+    }
+};
+
+TEST_P(EmbeddingBagSumTest, CompareWithReference) {
+    Precision prc;
+    size_t depth;
+    bool withWeights;
+    std::tie(prc, depth, withWeights) = GetParam();
+
+    const size_t rows = 50;
+    // an empty bag, a single row one and long bags which use the prefetch of the upcoming rows
+    const std::vector<int> bagSizes = {3, 0, 1, 17, 6, 40, 2};
+    std::vector<int> offsets;
+    int indicesNum = 0;
+    for (auto size : bagSizes) {
+        offsets.push_back(indicesNum);
+        indicesNum += size;
+    }
+
+    std::mt19937 gen(static_cast<unsigned>(depth * 7 + withWeights));
+    std::uniform_int_distribution<int> indexDist(0, static_cast<int>(rows) - 1);
+    std::uniform_real_distribution<float> valueDist(-4.f, 4.f);
+    std::vector<int> indices(indicesNum);
+    for (auto& index : indices)
+        index = indexDist(gen);
+    TableData table(prc), weights(prc);
+    for (size_t i = 0; i < rows * depth; i++)
+        table.push_back(valueDist(gen));
+    for (int i = 0; i < indicesNum; i++)
+        weights.push_back(valueDist(gen));
+
+    auto op = makeEmbeddingBagOffsetsSum(prc, rows, depth, indices.size(), offsets.size(), withWeights);
+    EmbeddingBagSumTestNode node(op, indices, offsets);
+    auto dst = makeMemory(prc, {offsets.size(), depth});
+    node.run(table.data(), withWeights ? weights.data() : nullptr, prc, {rows, depth}, dst);
+
+    // the low precision tables are accumulated in FP32, so only the store rounds to the table precision
+    const float eps = prc == Precision::BF16 ? 1.f / 128 : prc == Precision::FP16 ? 1.f / 1024 : 1e-6f;
+    for (size_t bag = 0; bag < offsets.size(); bag++) {
+        for (size_t d = 0; d < depth; d++) {
+            double expected = 0., absSum = 0.;
+            for (int i = offsets[bag]; i < offsets[bag] + bagSizes[bag]; i++) {
+                const double weight = withWeights ? weights.values[i] : 1.;
+                const double product = table.values[indices[i] * depth + d] * weight;
+                expected += product;
+                absSum += std::fabs(product);
+            }
+            const float threshold = eps * static_cast<float>(std::max(absSum, 1.));
+            ASSERT_NEAR(expected, readValue(dst, bag * depth + d), threshold) << "bag = " << bag << ", d = " << d;
+        }
+    }
+}
+
+// the depths cover the tails of the vectorized rows and the rows longer than the prefetched bytes
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagSum, EmbeddingBagSumTest,
+                         ::testing::Combine(::testing::Values(Precision::FP32, Precision::BF16, Precision::FP16),
+                                            ::testing::Values(1, 17, 300),
+                                            ::testing::Values(false, true)),
+                         EmbeddingBagSumTest::getTestCaseName);
+
+// a bag of a single row returns the row as is, so every FP16 value incl. denormals and Inf/NaN must round trip,
+// the only exception is the negative zero which becomes positive after the accumulation from zero
+TEST(EmbeddingBagSumFP16Test, AllValuesRoundTrip) {
+    const size_t depth = 1lu << 16;
+    std::vector<ov::float16> table(depth);
+    for (size_t i = 0; i < depth; i++)
+        table[i] = ov::float16::from_bits(static_cast<uint16_t>(i));
+
+    auto op = makeEmbeddingBagOffsetsSum(Precision::FP16, 1, depth, 1, 1, false);
+    EmbeddingBagSumTestNode node(op, {0}, {0});
+    auto dst = makeMemory(Precision::FP16, {1, depth});
+    node.run(table.data(), nullptr, Precision::FP16, {1, depth}, dst);
+
+    const auto* result = reinterpret_cast<const ov::float16*>(dst->getData());
+    for (size_t i = 0; i < depth; i++) {
+        const float expected = static_cast<float>(table[i]);
+        if (std::isnan(expected)) {
+            ASSERT_TRUE(std::isnan(static_cast<float>(result[i]))) << "bits = " << i;
+        } else {
+            ASSERT_EQ(expected, static_cast<float>(result[i])) << "bits = " << i;
+        }
+    }
+}
+
+}  // namespace
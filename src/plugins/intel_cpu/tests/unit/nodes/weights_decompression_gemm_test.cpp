@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include "nodes/common/weights_decompression_gemm.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace {
+
+enum class DecompressionParamType { None, PerTensor, PerChannel, Grouped };
+
+using WeightsDecompressionGemmParams = std::tuple<Precision,   // weights precision
+                                                  size_t,      // M
+                                                  size_t,      // N
+                                                  size_t,      // K
+                                                  DecompressionParamType,   // scale
+                                                  DecompressionParamType,   // zero point
+                                                  Precision>;  // source and destination precision
+
+std::string decompressionParamTypeToString(DecompressionParamType type) {
+    switch (type) {
+    case DecompressionParamType::None: return "none";
+    case DecompressionParamType::PerTensor: return "per_tensor";
+    case DecompressionParamType::PerChannel: return "per_channel";
+    case DecompressionParamType::Grouped: return "grouped";
+    }
+    return "";
+}
+
+class WeightsDecompressionGemmTest : public testing::TestWithParam<WeightsDecompressionGemmParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<WeightsDecompressionGemmParams>& obj) {
+        Precision weightsPrc, dataPrc;
+        size_t M, N, K;
+        DecompressionParamType scaleType, zeroPointType;
+        std::tie(weightsPrc, M, N, K, scaleType, zeroPointType, dataPrc) = obj.param;
+
+        std::ostringstream result;
+        result << "weights=" << weightsPrc.name() << "_M=" << M << "_N=" << N << "_K=" << K
+               << "_scale=" << decompressionParamTypeToString(scaleType) << "_zp=" << decompressionParamTypeToString(zeroPointType)
+               << "_data=" << dataPrc.name();
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t groupSize = 32;
+
+    // the dims of the scale / zero point constant, the grouped one is broadcasted to the weights [N, K / groupSize, groupSize]
+    static VectorDims paramDims(DecompressionParamType type, size_t N, size_t K) {
+        switch (type) {
+        case DecompressionParamType::PerTensor: return {1, 1};
+        case DecompressionParamType::PerChannel: return {N, 1};
+        case DecompressionParamType::Grouped: return {N, K / groupSize, 1};
+        default: return {};
+        }
+    }
+
+    static WeightsDecompressionParam makeParam(DecompressionParamType type, size_t N, size_t K, float low, float high, bool integer,
+                                               std::mt19937& gen, std::vector<float>& fullValues) {
+        WeightsDecompressionParam param;
+        fullValues.clear();
+        if (type == DecompressionParamType::None)
+            return param;
+
+        const auto dims = paramDims(type, N, K);
+        const size_t groups = type == DecompressionParamType::Grouped ? dims[1] : 1;
+        const size_t size = dims[0] * groups;
+        std::uniform_real_distribution<float> dist(low, high);
+        std::vector<float> values(size);
+        for (auto& v : values)
+            v = integer ? std::round(dist(gen)) : dist(gen);
+        const VectorDims weightsDims = type == DecompressionParamType::Grouped ? VectorDims{N, K / groupSize, groupSize} : VectorDims{N, K};
+        EXPECT_TRUE(param.init(values.data(), dims, weightsDims));
+
+        fullValues.resize(N * K);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t k = 0; k < K; k++) {
+                const size_t ni = dims[0] == 1 ? 0 : n;
+                const size_t gi = groups == 1 ? 0 : k / groupSize;
+                fullValues[n * K + k] = values[ni * groups + gi];
+            }
+        }
+        return param;
+    }
+};
+
+TEST_P(WeightsDecompressionGemmTest, CompareWithReference) {
+    Precision weightsPrc, dataPrc;
+    size_t M, N, K;
+    DecompressionParamType scaleType, zeroPointType;
+    std::tie(weightsPrc, M, N, K, scaleType, zeroPointType, dataPrc) = GetParam();
+
+    std::mt19937 gen(static_cast<unsigned>(M * 131 + N * 17 + K));
+    const bool is4bit = weightsPrc == Precision::U4 || weightsPrc == Precision::I4;
+    const bool isSigned = weightsPrc == Precision::I8 || weightsPrc == Precision::I4;
+    const int low = isSigned ? (is4bit ? -8 : -128) : 0;
+    const int high = isSigned ? (is4bit ? 7 : 127) : (is4bit ? 15 : 255);
+    std::uniform_int_distribution<int> weightsDist(low, high);
+
+    // unpacked weights, the U4/I4 ones are packed as FullyConnected does
+    std::vector<uint8_t> weights(N * K);
+    for (auto& w : weights)
+        w = static_cast<uint8_t>(weightsDist(gen));
+    std::vector<uint8_t> packedWeights = weights;
+    if (is4bit) {
+        const auto unpackedPrc = isSigned ? Precision::I8 : Precision::U8;
+        ASSERT_TRUE(weights_fit_into_4bit(weights.data(), unpackedPrc, weights.size()));
+        packedWeights.assign(N * ((K + 1) / 2), 0);
+        ASSERT_EQ(weightsPrc, pack_weights_to_4bit(weights.data(), packedWeights.data(), unpackedPrc, N, K));
+    }
+
+    std::vector<float> fullScale, fullZeroPoint;
+    const auto scale = makeParam(scaleType, N, K, 0.01f, 0.1f, false, gen, fullScale);
+    const auto zeroPoint = makeParam(zeroPointType, N, K, static_cast<float>(low), static_cast<float>(high), true, gen,
+                                     fullZeroPoint);
+
+    std::uniform_real_distribution<float> dataDist(-1.f, 1.f);
+    std::vector<float> src(M * K), bias(N);
+    for (auto& v : src)
+        v = dataDist(gen);
+    for (auto& v : bias)
+        v = dataDist(gen);
+    std::vector<bfloat16_t> srcBf16(src.begin(), src.end());
+    if (dataPrc == Precision::BF16) {
+        std::transform(srcBf16.begin(), srcBf16.end(), src.begin(), [](bfloat16_t v) { return static_cast<float>(v); });
+    }
+
+    // a unary and a per channel scale shift post op
+    std::vector<float> channelScale(N);
+    for (auto& v : channelScale)
+        v = dataDist(gen);
+    const std::vector<WeightsDecompressionPostOp> postOps = {
+        [](float* data, size_t, size_t count) {
+            for (size_t i = 0; i < count; i++)
+                data[i] = std::max(data[i], 0.f);
+        },
+        [&channelScale](float* data, size_t n0, size_t count) {
+            for (size_t i = 0; i < count; i++)
+                data[i] = data[i] * channelScale[n0 + i] + 0.5f;
+        }};
+
+    // the reference is accumulated in double, so the threshold grows with the sum of the absolute products
+    std::vector<float> expected(M * N), thresholds(M * N);
+    const float tolerance = dataPrc == Precision::BF16 ? 1e-2f : 1e-5f;
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            double acc = bias[n];
+            double absAcc = std::fabs(bias[n]);
+            for (size_t k = 0; k < K; k++) {
+                const float w = isSigned ? static_cast<int8_t>(weights[n * K + k]) : weights[n * K + k];
+                const float zp = fullZeroPoint.empty() ? 0.f : fullZeroPoint[n * K + k];
+                const float s = fullScale.empty() ? 1.f : fullScale[n * K + k];
+                const double product = static_cast<double>(src[m * K + k]) * ((w - zp) * s);
+                acc += product;
+                absAcc += std::fabs(product);
+            }
+            const size_t i = m * N + n;
+            expected[i] = std::max(static_cast<float>(acc), 0.f) * channelScale[n] + 0.5f;
+            thresholds[i] = 1e-5f * static_cast<float>(absAcc) * std::fabs(channelScale[n]) +
+                            tolerance * std::max(1.f, std::fabs(expected[i]));
+        }
+    }
+
+    std::vector<float> dst(M * N, 0.f);
+    std::vector<bfloat16_t> dstBf16(M * N, 0.f);
+    const void* srcData = dataPrc == Precision::BF16 ? static_cast<const void*>(srcBf16.data()) : src.data();
+    void* dstData = dataPrc == Precision::BF16 ? static_cast<void*>(dstBf16.data()) : dst.data();
+    weights_decompression_gemm(srcData, dataPrc, packedWeights.data(), weightsPrc, scale, zeroPoint, bias.data(),
+                               dstData, dataPrc, M, N, K, postOps);
+    if (dataPrc == Precision::BF16) {
+        std::transform(dstBf16.begin(), dstBf16.end(), dst.begin(), [](bfloat16_t v) { return static_cast<float>(v); });
+    }
+
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_NEAR(expected[i], dst[i], thresholds[i]) << "m = " << i / N << ", n = " << i % N;
+}
+
+const std::vector<Precision> weightsPrecisions = {Precision::U8, Precision::I8, Precision::U4, Precision::I4};
+
+// N and K which are not multiple of the gemm blocks, the odd K leaves a half empty byte at the end of INT4 rows
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsDecompressionGemm_PerChannel, WeightsDecompressionGemmTest,
+                         ::testing::Combine(::testing::ValuesIn(weightsPrecisions),
+                                            ::testing::Values(1, 5),
+                                            ::testing::Values(1, 37),
+                                            ::testing::Values(1, 15, 300),
+                                            ::testing::Values(DecompressionParamType::PerTensor, DecompressionParamType::PerChannel),
+                                            ::testing::Values(DecompressionParamType::None, DecompressionParamType::PerChannel),
+                                            ::testing::Values(Precision::FP32, Precision::BF16)),
+                         WeightsDecompressionGemmTest::getTestCaseName);
+
+// the groups cross the K blocks of the gemm, the scale and the zero point may change at different input channels
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsDecompressionGemm_Grouped, WeightsDecompressionGemmTest,
+                         ::testing::Combine(::testing::ValuesIn(weightsPrecisions),
+                                            ::testing::Values(1, 9),
+                                            ::testing::Values(16, 33),
+                                            ::testing::Values(96, 608),
+                                            ::testing::Values(DecompressionParamType::PerChannel, DecompressionParamType::Grouped),
+                                            ::testing::Values(DecompressionParamType::None,
+                                                              DecompressionParamType::PerTensor,
+                                                              DecompressionParamType::Grouped),
+                                            ::testing::Values(Precision::FP32, Precision::BF16)),
+                         WeightsDecompressionGemmTest::getTestCaseName);
+
+}  // namespace
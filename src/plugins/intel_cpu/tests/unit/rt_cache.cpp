@@ -379,3 +379,42 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SmokeThreadSafeSharedCache) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+    constexpr size_t numThreads = 30;
+
+    MultiCache cache(capacity, true);
+    std::atomic<int> numBuilds{0};
+
+    auto intBuilder = [&](const IntKey& key) {
+        numBuilds++;
+        return std::make_shared<int>(key.data);
+    };
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // every value is built at least once and then served from the cache
+    ASSERT_GE(numBuilds, capacity);
+    for (int i = 0; i < capacity; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(*intResult.first, i);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// straightforward byte-at-a-time ECMA-182 CRC64 to check the optimized implementation against
+uint64_t referenceHash(const unsigned char* data, size_t size) {
+    uint64_t table[256];
+    for (int i = 0; i < 256; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+        table[i] = c;
+    }
+
+    uint64_t crc = 0;
+    for (size_t idx = 0; idx < size; idx++)
+        crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::vector<unsigned char> makeRandomData(size_t size) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<unsigned char> data(size);
+    for (auto& item : data)
+        item = static_cast<unsigned char>(dist(gen));
+    return data;
+}
+}  // namespace
+
+TEST(WeightsCacheHashTests, MatchesReference) {
+    const auto data = makeRandomData((17 << 20) + 3);
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+
+    const std::vector<size_t> sizes = {0, 1, 7, 8, 9, 1000, size_t{2} << 20, (size_t{3} << 20) + 5, data.size()};
+    for (size_t size : sizes) {
+        ASSERT_EQ(hashFunc.hash(data.data(), size), referenceHash(data.data(), size)) << "size: " << size;
+    }
+}
+
+TEST(WeightsCacheHashTests, Stable) {
+    const auto data = makeRandomData(5 << 20);
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+
+    const auto expected = hashFunc.hash(data.data(), data.size());
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(hashFunc.hash(data.data(), data.size()), expected);
+    }
+}
+
+// Micro-benchmark of the weights hashing throughput, run with --gtest_also_run_disabled_tests
+TEST(WeightsCacheHashTests, DISABLED_Throughput) {
+    const auto data = makeRandomData(size_t{1} << 30);
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    constexpr int iterations = 5;
+
+    volatile uint64_t hash = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        hash = hashFunc.hash(data.data(), data.size());
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    (void)hash;
+
+    const double throughput = static_cast<double>(data.size()) * iterations / elapsed.count() / 1e9;
+    std::cout << "Weights hashing throughput: " << throughput << " GB/s" << std::endl;
+}